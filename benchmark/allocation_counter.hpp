@@ -0,0 +1,53 @@
+// Counter of heap allocations.
+//
+// Replaces global 'operator new' and 'operator delete' (unsized and sized) by counting ones.
+// Replacement functions must be defined once in program, so include this file in one
+// translation unit only. Counters are not atomic: don't use it in threaded benchmarks.
+//
+// 'allocated_bytes' grows with every allocation (so it includes memory freed later),
+// 'live_bytes' is memory allocated and not freed yet. Size of every allocation is stored
+// in header before it, so 'operator delete' knows how many bytes are freed.
+
+#ifndef CLPP_BENCHMARK_ALLOCATION_COUNTER_HPP
+#define CLPP_BENCHMARK_ALLOCATION_COUNTER_HPP
+
+#include <boost/config.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+size_t allocated_bytes = 0;
+size_t live_bytes = 0;
+size_t allocations = 0;
+
+/// Header keeps alignment of allocated memory.
+const size_t allocation_header_size = sizeof( std::max_align_t );
+
+void* operator new( size_t size ) {
+    allocated_bytes += size;
+    live_bytes += size;
+    ++allocations;
+    char* p = static_cast< char* >( std::malloc( allocation_header_size + size ) );
+    if ( 0 == p ) {
+        throw std::bad_alloc();
+    } else {}
+    *reinterpret_cast< size_t* >( p ) = size;
+    return p + allocation_header_size;
+}
+
+/// Not inlined: otherwise GCC sees 'free()' of pointer from 'operator new' and warns about mismatch.
+BOOST_NOINLINE void operator delete( void* p ) throw() {
+    if ( 0 == p ) {
+        return;
+    } else {}
+    char* header = static_cast< char* >( p ) - allocation_header_size;
+    live_bytes -= *reinterpret_cast< size_t* >( header );
+    std::free( header );
+}
+
+BOOST_NOINLINE void operator delete( void* p, size_t /* size */ ) throw() {
+    operator delete( p );
+}
+
+#endif // CLPP_BENCHMARK_ALLOCATION_COUNTER_HPP
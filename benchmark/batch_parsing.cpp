@@ -0,0 +1,76 @@
+// Benchmark of batch parsing of job file.
+//
+// Generates file with many command lines and parses it with batch parser,
+// throughput is compared with simple counting of lines in the same mapped file.
+//
+// Build (for example):
+// g++ -O2 -I.. batch_parsing.cpp -lboost_thread -lboost_chrono -lboost_filesystem -lboost_system -lpthread
+//
+// Usage:
+// ./batch_parsing [--output=results.json] [--quick]
+
+#include "benchmark.hpp"
+
+#include <clpp/batch_parser.hpp>
+
+#include <cstdio>
+
+void register_parameters( clpp::command_line_parameters_parser& parser ) {
+    parser.add_parameter( "-v", "--verbose", some_flag );
+    parser.add_parameter( "-n", "--number", some_num ).necessary();
+    parser.add_parameter( "-i", "--input", some_str ).default_value( "/dev/null" );
+    parser.add_parameter( "-u", "--user", some_str );
+    parser.freeze();
+}
+
+void generate_job_file( const std::string& path, size_t lines_quantity ) {
+    std::ofstream file( path.c_str() );
+    for ( size_t i = 0; i < lines_quantity; ++i ) {
+        file << "job --number=" << i << " --input='/data/input " << i % 100 << ".txt' -v --user=u" << i % 7 << '\n';
+    }
+}
+
+double lines_counting_time( const std::string& path ) {
+    using namespace boost::interprocess;
+    file_mapping file( path.c_str(), read_only );
+    mapped_region region( file, read_only );
+    const char* begin = static_cast< const char* >( region.get_address() );
+    const char* end = begin + region.get_size();
+
+    const clock_type::time_point start = clock_type::now();
+    const size_t lines = static_cast< size_t >( std::count( begin, end, '\n' ) );
+    const double seconds = nanoseconds_since( start ) / 1e9;
+    std::cerr << "counted " << lines << " lines" << std::endl;
+    return seconds;
+}
+
+int main( int argc, char* argv[] ) {
+    benchmark_options options;
+    if ( !obtain_options( argc, argv, options ) ) {
+        return 1;
+    } else {}
+
+    const std::string path = "batch_parsing_jobs.txt";
+    generate_job_file( path, options.scaled( 2000000 ) );
+    const double megabytes = static_cast< double >( boost::filesystem::file_size( path ) ) / ( 1024.0 * 1024.0 );
+
+    clpp::command_line_parameters_parser parser;
+    register_parameters( parser );
+    clpp::batch_parser batch( parser );
+    clpp::line_results results;
+
+    const double counting_seconds = lines_counting_time( path );
+    const clock_type::time_point start = clock_type::now();
+    batch.parse_file( path, results );
+    const double parsing_seconds = nanoseconds_since( start ) / 1e9;
+    const double lines = static_cast< double >( results.size() );
+
+    measurements measured;
+    add_measurement( measured, "batch", "lines_counting", 0, 0, megabytes / counting_seconds, "MB_per_second" );
+    add_measurement( measured, "batch", "parsing", 4, 4, megabytes / parsing_seconds, "MB_per_second" );
+    add_measurement( measured, "batch", "parsing", 4, 4, lines / parsing_seconds, "lines_per_second" );
+    write_results( "batch_parsing", measured, options );
+
+    std::remove( path.c_str() );
+    return 0;
+}
@@ -0,0 +1,174 @@
+// Common part of benchmarks.
+//
+// Clock, median of samples, user's functions, owner of inputed parameters, and results:
+// every benchmark adds its measurements as records of the same format (group, name, quantity
+// of registered and inputed parameters, metric and its value) and writes them in JSON, so results
+// of all benchmarks (and of different releases) can be compared by the same scripts.
+//
+// Every benchmark accepts the same options:
+// ./benchmark [--output=results.json] [--quick]
+//
+// Without '--output' results are written to standard output (and human-readable lines
+// to standard error). With '--quick' every measurement is shorter (for smoke runs).
+
+#ifndef CLPP_BENCHMARK_BENCHMARK_HPP
+#define CLPP_BENCHMARK_BENCHMARK_HPP
+
+#include <clpp/parser.hpp>
+
+#include <boost/chrono.hpp>
+#include <boost/config.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef boost::chrono::high_resolution_clock clock_type;
+
+inline double nanoseconds_since( const clock_type::time_point& start ) {
+    return boost::chrono::duration_cast< boost::chrono::duration< double, boost::nano > >( clock_type::now() - start ).count();
+}
+
+inline double median( std::vector< double > samples ) {
+    std::sort( samples.begin(), samples.end() );
+    return samples[samples.size() / 2];
+}
+
+inline void some_flag() {}
+inline void some_num( int /* number */ ) {}
+inline void some_real( double /* number */ ) {}
+inline void some_str( const std::string& /* str */ ) {}
+
+inline std::string option_name( size_t number ) {
+    return "--option-" + clpp::detail::to_str( number );
+}
+
+/// \class command_line
+/// \brief Owner of inputed parameters, presents them as 'argc' and 'argv'.
+class command_line {
+public:
+    command_line() : words( 1, "benchmark" ) {}
+private:
+    std::vector< std::string >  words;
+    std::vector< char* >        pointers;
+public:
+    void add( const std::string& word ) { words.push_back( word ); }
+
+    int argc() const { return static_cast< int >( words.size() ); }
+
+    char** argv() {
+        pointers.clear();
+        for ( size_t i = 0; i < words.size(); ++i ) {
+            pointers.push_back( &words[i][0] );
+        }
+        pointers.push_back( 0 );
+        return &pointers[0];
+    }
+};
+
+/// \struct benchmark_options
+/// \brief Options of benchmark, obtained from command line (by CLPP itself).
+struct benchmark_options {
+    benchmark_options() : quick( false ) {}
+
+    std::string output;
+    bool        quick;
+public:
+    void set_output( const std::string& path ) { output = path; }
+    void set_quick() { quick = true; }
+    /// Quantity of iterations (or size of input) for this run.
+    size_t scaled( size_t quantity ) const { return quick ? std::max< size_t >( 1, quantity / 10 ) : quantity; }
+};
+
+inline bool obtain_options( int argc, char* argv[], benchmark_options& options ) {
+    try {
+        clpp::command_line_parameters_parser parser;
+        parser.add_parameter( "-o", "--output", &options, &benchmark_options::set_output );
+        parser.add_parameter( "-q", "--quick", &options, &benchmark_options::set_quick );
+        parser.parse( argc, argv );
+    } catch ( const std::exception& exc ) {
+        std::cerr << exc.what() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/// \struct measurement
+/// \brief One result of benchmark.
+struct measurement {
+    std::string group;
+    std::string name;
+    size_t      registered;
+    size_t      inputed;
+    std::string metric;
+    double      value;
+};
+
+typedef std::vector< measurement > measurements;
+
+inline void add_measurement( measurements&         results
+                             , const std::string&  group
+                             , const std::string&  name
+                             , size_t              registered
+                             , size_t              inputed
+                             , double              value
+                             , const std::string&  metric = "ns_per_operation" ) {
+    measurement result;
+    result.group        = group;
+    result.name         = name;
+    result.registered   = registered;
+    result.inputed      = inputed;
+    result.metric       = metric;
+    result.value        = value;
+    results.push_back( result );
+    std::cerr << group << "/" << name << ": " << value << " " << metric << std::endl;
+}
+
+// JSON output.
+
+inline std::string json_string( const std::string& text ) {
+    std::string quoted = "\"";
+    for ( size_t i = 0; i < text.size(); ++i ) {
+        if ( '"' == text[i] || '\\' == text[i] ) {
+            quoted += '\\';
+        } else {}
+        quoted += text[i];
+    }
+    return quoted + "\"";
+}
+
+inline void write_json( const std::string& benchmark, const measurements& results, std::ostream& out ) {
+    out << "{\n"
+        << "  \"suite\": \"clpp\",\n"
+        << "  \"benchmark\": " << json_string( benchmark ) << ",\n"
+        << "  \"compiler\": " << json_string( BOOST_COMPILER ) << ",\n"
+        << "  \"cplusplus\": " << __cplusplus << ",\n"
+        << "  \"results\": [\n";
+    for ( size_t i = 0; i < results.size(); ++i ) {
+        const measurement& result = results[i];
+        out << "    { \"group\": " << json_string( result.group )
+            << ", \"name\": " << json_string( result.name )
+            << ", \"registered\": " << result.registered
+            << ", \"inputed\": " << result.inputed
+            << ", \"metric\": " << json_string( result.metric )
+            << ", \"value\": " << result.value
+            << " }" << ( i + 1 < results.size() ? "," : "" ) << "\n";
+    }
+    out << "  ]\n"
+        << "}\n";
+}
+
+inline void write_results( const std::string&           benchmark
+                           , const measurements&        results
+                           , const benchmark_options&   options ) {
+    if ( options.output.empty() ) {
+        write_json( benchmark, results, std::cout );
+    } else {
+        std::ofstream out( options.output.c_str() );
+        write_json( benchmark, results, out );
+    }
+}
+
+#endif // CLPP_BENCHMARK_BENCHMARK_HPP
@@ -0,0 +1,118 @@
+// Check of variables after failed parsing.
+//
+// Value of parameter bound to variable is converted directly into variable, and incorrect value
+// must not change it: neither partially accumulated number, nor partially converted list, 
+// nor engaged empty 'optional'. Correct values are checked too. Returns non-zero if some variable 
+// is changed by incorrect value (or not changed by correct one).
+//
+// Build (for example):
+// g++ -std=c++17 -O2 -I.. bound_variables_check.cpp -lboost_filesystem -lboost_system
+
+#include <clpp/parser.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+size_t failures = 0;
+size_t checks = 0;
+
+bool parsed( clpp::command_line_parameters_parser& parser, const std::string& parameter ) {
+    char program[] = "program";
+    char* argv[] = { program, const_cast< char* >( parameter.c_str() ) };
+    try {
+        parser.parse( 2, argv );
+    } catch ( const std::exception& /* exc */ ) {
+        return false;
+    }
+    return true;
+}
+
+template< typename T >
+std::string printed( const T& value ) {
+    std::ostringstream out;
+    out << value;
+    return out.str();
+}
+
+template< typename T >
+std::string printed( const std::vector< T >& values ) {
+    std::string result = "[";
+    for ( size_t i = 0; i < values.size(); ++i ) {
+        result += ( 0 == i ? "" : "," ) + printed( values[i] );
+    }
+    return result + "]";
+}
+
+template< typename T >
+std::string printed( const boost::optional< T >& value ) {
+    return value ? printed( *value ) : "<empty>";
+}
+
+/// Variable with 'initial' value is bound to parameter '-v', and after parsing of 'value'
+/// it must be 'expected' (accepted value) or still 'initial' (rejected value).
+template< typename Variable >
+void check( const Variable& initial, const std::string& value, bool correct, const Variable& expected ) {
+    ++checks;
+    Variable variable = initial;
+    clpp::command_line_parameters_parser parser;
+    parser.add_parameter( "-v", &variable );
+
+    const bool accepted = parsed( parser, "-v=" + value );
+    const Variable& wanted = correct ? expected : initial;
+    if ( accepted != correct || !( variable == wanted ) ) {
+        std::cout << "FAILED: '" << value << "' is " << ( accepted ? "accepted" : "rejected" )
+                  << ", variable is " << printed( variable ) << " instead of " << printed( wanted ) << std::endl;
+        ++failures;
+    } else {}
+}
+
+template< typename Variable >
+void check_incorrect( const Variable& initial, const std::string& value ) {
+    check( initial, value, false, initial );
+}
+
+std::vector< int > list( int a, int b = -1, int c = -1 ) {
+    std::vector< int > values( 1, a );
+    if ( -1 != b ) {
+        values.push_back( b );
+    } else {}
+    if ( -1 != c ) {
+        values.push_back( c );
+    } else {}
+    return values;
+}
+
+int main() {
+    check_incorrect( 7u, "99999999999" );
+    check_incorrect( 7u, "-1" );
+    check_incorrect( 7u, "12x" );
+    check( 7u, "42", true, 42u );
+    check_incorrect( 7, "99999999999" );
+    check_incorrect( 7, "-99999999999" );
+    check_incorrect( 7, "12x" );
+    check( 7, "-42", true, -42 );
+    check_incorrect( 7L, "99999999999999999999" );
+    check_incorrect( 7.0, "abc" );
+    check_incorrect( 7.0, "1.5x" );
+    check_incorrect( 7.0, "1e400" );
+    check( 7.0, "1.5", true, 1.5 );
+    check_incorrect( 7.0f, "1e-45" );
+    check_incorrect( true, "maybe" );
+    check_incorrect( 'a', "abc" );
+    check_incorrect( list( 7 ), "1,2,x" );
+    check_incorrect( list( 7 ), "x,2,3" );
+    check_incorrect( list( 7, 8, 9 ), "1,99999999999" );
+    check_incorrect( list( 7, 8, 9 ), "1,2," );
+    check( list( 7 ), "1,2,3", true, list( 1, 2, 3 ) );
+    check( list( 7, 8, 9 ), "1", true, list( 1 ) );
+    check_incorrect( std::vector< double >( 2, 7.0 ), "1.5,abc" );
+    check_incorrect( boost::optional< int >(), "12x" );
+    check_incorrect( boost::optional< int >( 7 ), "99999999999" );
+    check( boost::optional< int >(), "42", true, boost::optional< int >( 42 ) );
+    check( std::string( "initial" ), "1,2,x", true, std::string( "1,2,x" ) );
+
+    std::cout << ( 0 == failures ? "ok: " : "FAILED: " ) << checks << " values" << std::endl;
+    return 0 == failures ? 0 : 1;
+}
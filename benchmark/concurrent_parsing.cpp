@@ -0,0 +1,76 @@
+// Benchmark of concurrent parsing with one frozen parser.
+//
+// Every thread parses the same command line many times with its own parse context,
+// so the result shows how throughput scales with the quantity of threads.
+//
+// Build (for example):
+// g++ -O2 -I.. concurrent_parsing.cpp -lboost_thread -lboost_chrono -lboost_filesystem -lboost_system -lpthread
+//
+// Usage:
+// ./concurrent_parsing [--output=results.json] [--quick]
+
+#include "benchmark.hpp"
+
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+
+void register_parameters( clpp::command_line_parameters_parser& parser ) {
+    parser.add_parameter( "-h", "--help", some_flag );
+    parser.add_parameter( "-v", "--verbose", some_flag );
+    parser.add_parameter( "-n", "--number", some_num ).necessary();
+    parser.add_parameter( "-t", "--threshold", some_real ).default_value( 0.5 );
+    parser.add_parameter( "-f", "--file", some_str ).order( 1 );
+    parser.add_parameter( "-u", "--user", some_str );
+    parser.freeze();
+}
+
+void parse_many_times( const clpp::command_line_parameters_parser& parser, size_t parsings_per_thread ) {
+    const char* inputed_parameters[] = { "benchmark", "input.txt", "--verbose", "-n=42", "--user=root" };
+    const int argc = sizeof( inputed_parameters ) / sizeof( inputed_parameters[0] );
+    char** argv = const_cast< char** >( inputed_parameters );
+
+    clpp::parse_context context;
+    for ( size_t i = 0; i < parsings_per_thread; ++i ) {
+        parser.parse( argc, argv, context );
+    }
+}
+
+double parsings_per_second( const clpp::command_line_parameters_parser&  parser
+                            , size_t                                    threads_quantity
+                            , size_t                                    parsings_per_thread ) {
+    boost::thread_group threads;
+    const clock_type::time_point start = clock_type::now();
+    for ( size_t i = 0; i < threads_quantity; ++i ) {
+        threads.create_thread( boost::bind( parse_many_times, boost::cref( parser ), parsings_per_thread ) );
+    }
+    threads.join_all();
+    const double seconds = nanoseconds_since( start ) / 1e9;
+    return static_cast< double >( threads_quantity * parsings_per_thread ) / seconds;
+}
+
+/// Name of measurement is the quantity of threads, speedup is relative to one thread.
+int main( int argc, char* argv[] ) {
+    benchmark_options options;
+    if ( !obtain_options( argc, argv, options ) ) {
+        return 1;
+    } else {}
+
+    clpp::command_line_parameters_parser parser;
+    register_parameters( parser );
+
+    const size_t parsings_per_thread = options.scaled( 200000 );
+    const size_t cores = std::max< size_t >( 1, boost::thread::hardware_concurrency() );
+    measurements results;
+    double single_thread_throughput = 0;
+    for ( size_t threads_quantity = 1; threads_quantity <= cores; threads_quantity *= 2 ) {
+        const double throughput = parsings_per_second( parser, threads_quantity, parsings_per_thread );
+        if ( 1 == threads_quantity ) {
+            single_thread_throughput = throughput;
+        } else {}
+        const std::string threads = clpp::detail::to_str( threads_quantity );
+        add_measurement( results, "concurrent", threads, 6, 4, throughput, "parsings_per_second" );
+        add_measurement( results, "concurrent", threads, 6, 4, throughput / single_thread_throughput, "speedup" );
+    }
+    write_results( "concurrent_parsing", results, options );
+    return 0;
+}
@@ -0,0 +1,157 @@
+// Stress test of concurrent parsing with one frozen parser (for ThreadSanitizer).
+//
+// Many threads parse with one shared frozen parser, each with its own parse context: correct
+// command lines (with values of every semantic, default values, unnamed parameter and flag)
+// and incorrect ones (repeated flag). Every thread checks values received by user's functions.
+// Returns non-zero if some parsing gives wrong result. Build it with '-fsanitize=thread'
+// so data races between parsing threads are reported.
+//
+// Build (for example):
+// g++ -O1 -g -fsanitize=thread -I.. concurrent_parsing_stress.cpp -lboost_thread -lboost_filesystem -lboost_system -lpthread
+//
+// Usage:
+// ./concurrent_parsing_stress [--threads=64] [--parsings=2000]
+
+#include <clpp/parser.hpp>
+
+#include <boost/thread.hpp>
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+
+#include <iostream>
+#include <vector>
+
+/// Dozens of threads by default, so parsers really run concurrently even on many cores.
+size_t threads_quantity = 64;
+size_t parsings_per_thread = 2000;
+
+/// \struct thread_values
+/// \brief Values received by user's functions in one thread.
+struct thread_values {
+    thread_values() :
+            integers_sum( 0 )
+            , reals_sum( 0 )
+            , flags( 0 ) {}
+
+    long        integers_sum;
+    double      reals_sum;
+    size_t      flags;
+    std::string last_string;
+};
+
+boost::thread_specific_ptr< thread_values > values;
+
+void some_num( int number ) { values->integers_sum += number; }
+void some_real( double number ) { values->reals_sum += number; }
+void some_flag() { ++values->flags; }
+void some_str( const std::string& str ) { values->last_string = str; }
+
+boost::atomic< size_t > failures( 0 );
+
+void register_parameters( clpp::command_line_parameters_parser& parser ) {
+    parser.add_parameter( "-i", "--integer", some_num ).necessary();
+    parser.add_parameter( "-r", "--real", some_real ).default_value( 0.5 );
+    parser.add_parameter( "-h", "--help", some_flag );
+    parser.add_parameter( "-w", "--word", some_str ).order( 1 );
+    parser.add_parameter( "-p", "--path", some_str ).check_semantic( clpp::path ).default_value( "." );
+    parser.add_parameter( "-a", "--address", some_str ).check_semantic( clpp::ip );
+    parser.add_parameter( "-e", "--email", some_str ).check_semantic( clpp::email );
+}
+
+/// Owner of inputed parameters, presents them as 'argc' and 'argv'.
+struct command_line {
+    void add( const std::string& word ) { words.push_back( word ); }
+
+    std::vector< std::string >  words;
+    std::vector< char* >        pointers;
+public:
+    int argc() const { return static_cast< int >( words.size() ); }
+    char** argv() {
+        pointers.clear();
+        for ( size_t i = 0; i < words.size(); ++i ) {
+            pointers.push_back( &words[i][0] );
+        }
+        pointers.push_back( 0 );
+        return &pointers[0];
+    }
+};
+
+void parse_many_times( const clpp::command_line_parameters_parser& parser, size_t number ) {
+    values.reset( new thread_values );
+    const std::string suffix = clpp::detail::to_str( number );
+    // Address is valid for any number of threads.
+    const std::string address = "10.0." + clpp::detail::to_str( number / 256 % 256 ) 
+                                + "." + clpp::detail::to_str( number % 256 );
+
+    command_line correct;
+    correct.add( "program" );
+    correct.add( "word-" + suffix );
+    correct.add( "--integer=" + suffix );
+    correct.add( "-h" );
+    correct.add( "-a=" + address );
+    correct.add( "-e=user" + suffix + "@example.com" );
+
+    command_line incorrect;
+    incorrect.add( "program" );
+    incorrect.add( "-h" );
+    incorrect.add( "-h" );
+
+    clpp::parse_context context;
+    for ( size_t i = 0; i < parsings_per_thread; ++i ) {
+        try {
+            parser.parse( correct.argc(), correct.argv(), context );
+        } catch ( const std::exception& /* exc */ ) {
+            ++failures;
+        }
+        try {
+            parser.parse( incorrect.argc(), incorrect.argv(), context );
+            ++failures;
+        } catch ( const std::runtime_error& /* exc */ ) {}
+    }
+
+    const bool values_are_correct = static_cast< long >( number * parsings_per_thread ) == values->integers_sum
+                                    && 0.5 * parsings_per_thread == values->reals_sum
+                                    && parsings_per_thread == values->flags
+                                    && "." == values->last_string;
+    if ( !values_are_correct ) {
+        ++failures;
+    } else {}
+}
+
+bool obtain_options( int argc, char* argv[] ) {
+    try {
+        clpp::command_line_parameters_parser parser;
+        parser.add_parameter( "-t", "--threads", &threads_quantity );
+        parser.add_parameter( "-p", "--parsings", &parsings_per_thread );
+        parser.parse( argc, argv );
+    } catch ( const std::exception& exc ) {
+        std::cerr << exc.what() << std::endl;
+        return false;
+    }
+    return 0 != threads_quantity;
+}
+
+int main( int argc, char* argv[] ) {
+    if ( !obtain_options( argc, argv ) ) {
+        return 1;
+    } else {}
+
+    clpp::command_line_parameters_parser parser;
+    try {
+        register_parameters( parser );
+        parser.freeze();
+    } catch ( const std::exception& exc ) {
+        std::cerr << exc.what() << std::endl;
+        return 1;
+    }
+
+    boost::thread_group threads;
+    for ( size_t number = 0; number < threads_quantity; ++number ) {
+        threads.create_thread( boost::bind( parse_many_times, boost::cref( parser ), number ) );
+    }
+    threads.join_all();
+
+    std::cout << threads_quantity << " threads, " << parsings_per_thread << " parsings per thread, "
+              << failures << " failures" << std::endl;
+    return 0 == failures ? 0 : 1;
+}
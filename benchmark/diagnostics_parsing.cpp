@@ -0,0 +1,84 @@
+// Benchmark of parsing with diagnostics.
+//
+// Compares usual parsing (first problem is reported by exception) with parsing 
+// that collects all problems in 'clpp::diagnostics', for correct and incorrect command lines.
+//
+// Build (for example):
+// g++ -O2 -I.. diagnostics_parsing.cpp -lboost_chrono -lboost_filesystem -lboost_system
+//
+// Usage:
+// ./diagnostics_parsing [--output=results.json] [--quick]
+
+#include "benchmark.hpp"
+
+void register_parameters( clpp::command_line_parameters_parser& parser ) {
+    parser.add_parameter( "-h", "--help", some_flag );
+    parser.add_parameter( "-v", "--verbose", some_flag );
+    parser.add_parameter( "-n", "--number", some_num ).necessary();
+    parser.add_parameter( "-t", "--threshold", some_real ).default_value( 0.5 );
+    parser.add_parameter( "-a", "--address", some_str ).check_semantic( clpp::ip );
+    parser.add_parameter( "-u", "--user", some_str );
+    parser.freeze();
+}
+
+double usual_parsing_time( const clpp::command_line_parameters_parser&  parser
+                           , int                                        argc
+                           , char**                                     argv
+                           , size_t                                     parsings ) {
+    clpp::parse_context context;
+    const clock_type::time_point start = clock_type::now();
+    for ( size_t i = 0; i < parsings; ++i ) {
+        try {
+            parser.parse( argc, argv, context );
+        } catch ( const std::exception& /* exc */ ) {}
+    }
+    return nanoseconds_since( start ) / static_cast< double >( parsings );
+}
+
+double parsing_with_diagnostics_time( const clpp::command_line_parameters_parser&  parser
+                                      , int                                         argc
+                                      , char**                                      argv
+                                      , size_t                                      parsings ) {
+    clpp::parse_context context;
+    clpp::diagnostics problems;
+    const clock_type::time_point start = clock_type::now();
+    for ( size_t i = 0; i < parsings; ++i ) {
+        parser.parse( argc, argv, context, problems );
+    }
+    return nanoseconds_since( start ) / static_cast< double >( parsings );
+}
+
+void compare( const clpp::command_line_parameters_parser& parser
+              , const std::string&                        line_name
+              , const char**                              inputed_parameters
+              , int                                       argc
+              , const benchmark_options&                  options
+              , measurements&                             results ) {
+    char** argv = const_cast< char** >( inputed_parameters );
+    const size_t parsings = options.scaled( 200000 );
+    const size_t inputed = static_cast< size_t >( argc - 1 );
+    add_measurement( results, line_name, "usual", 6, inputed, usual_parsing_time( parser, argc, argv, parsings ) );
+    add_measurement( results, line_name, "with_diagnostics", 6, inputed
+                     , parsing_with_diagnostics_time( parser, argc, argv, parsings ) );
+}
+
+int main( int argc, char* argv[] ) {
+    benchmark_options options;
+    if ( !obtain_options( argc, argv, options ) ) {
+        return 1;
+    } else {}
+
+    clpp::command_line_parameters_parser parser;
+    register_parameters( parser );
+
+    const char* correct[]   = { "benchmark", "--verbose", "-n=42", "-a=10.0.0.1", "--user=root" };
+    const char* one_error[] = { "benchmark", "--verbose", "-n=42", "-a=10.0.0", "--user=root" };
+    const char* errors[]    = { "benchmark", "--verbos", "-n=x", "-a=10.0.0", "-h=1" };
+
+    measurements results;
+    compare( parser, "correct", correct, sizeof( correct ) / sizeof( correct[0] ), options, results );
+    compare( parser, "one_error", one_error, sizeof( one_error ) / sizeof( one_error[0] ), options, results );
+    compare( parser, "many_errors", errors, sizeof( errors ) / sizeof( errors[0] ), options, results );
+    write_results( "diagnostics_parsing", results, options );
+    return 0;
+}
@@ -0,0 +1,136 @@
+// Differential check of 'email' semantic.
+//
+// Compares CLPP's linear e-mail matcher with the regular expression it replaced (Boost.Regex,
+// the way e-mails were checked before) on differential corpus: edge cases, all strings up to
+// some length over small alphabet, every byte at every position of valid e-mail, and random
+// strings near valid e-mails (with fixed seed, so corpus is the same on every run).
+// Reports every difference of acceptance, returns non-zero if some difference is found.
+//
+// Build (for example):
+// g++ -O2 -I.. email_validation_check.cpp -lboost_regex -lboost_filesystem -lboost_system
+
+#include <clpp/detail/checkers/validators.hpp>
+
+#include <boost/regex.hpp>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+const size_t max_exhaustive_length = 9;
+const size_t random_samples_quantity = 2000000;
+const size_t max_reported_differences = 20;
+
+size_t checked = 0;
+size_t accepted = 0;
+size_t differences = 0;
+
+/// Check of 'email' semantic as it was implemented via Boost.Regex.
+bool regex_email_is_valid( const std::string& email ) {
+    static const boost::regex e( "[a-zA-Z0-9_.-]{1,}[a-zA-Z0-9]{1,}@[a-zA-Z0-9]{1,}[a-zA-Z0-9_.-]{1,}.[a-zA-Z]{2,6}" );
+    return boost::regex_match( email, e );
+}
+
+void compare( const std::string& email ) {
+    const bool by_regex = regex_email_is_valid( email );
+    ++checked;
+    accepted += by_regex ? 1 : 0;
+    if ( by_regex != clpp::detail::email_is_valid( email ) ) {
+        if ( ++differences <= max_reported_differences ) {
+            std::cout << "difference: '" << email << "' (" << email.size() << " symbols) is "
+                      << ( by_regex ? "accepted" : "rejected" ) << " by regular expression only" << std::endl;
+        } else {}
+    } else {}
+}
+
+void compare_edge_cases() {
+    const char* samples[] = { "", "@", "a@b", "ab@cd", "ab@cd.ef", "a.b@c.d", "ab@c1.de", "ab@cd@ef"
+                              , "ab@cd.efghij", "ab@cd.efghijk", "ab@cd.e", "ab@cd.e1", "-b@cd.ef", "a-@cd.ef"
+                              , "ab@-d.ef", "ab@c-.ef", "ab@c-@ef", "ab@cdXef", "ab@@cd.ef", "ab@cde", "ab@cdef"
+                              , "ab@cdefg", "ab@c.dd", "ab@cc.dd", ".b@cd.ef", "ab@cd..ef", "ab@cd.ef.", "ab.@cd.ef"
+                              , "user@mail.com", "first.last@sub.domain.org", "denis@example.com", "a_b@c_d.ef"
+                              , "ab@cd\nef", "ab@cd ef", " ab@cd.ef", "ab@cd.ef " };
+    for ( size_t i = 0; i < sizeof( samples ) / sizeof( samples[0] ); ++i ) {
+        compare( samples[i] );
+    }
+    compare( std::string( "ab@cd\0ef", 8 ) );
+}
+
+/// Alphabet contains one symbol of every class that matters for e-mail.
+void compare_all_short_strings() {
+    const char alphabet[] = "a0.@-";
+    const size_t alphabet_size = sizeof( alphabet ) - 1;
+    for ( size_t length = 0; length <= max_exhaustive_length; ++length ) {
+        std::vector< size_t > digits( length, 0 );
+        std::string email( length, alphabet[0] );
+        for ( ;; ) {
+            compare( email );
+            size_t position = 0;
+            while ( position < length && alphabet_size == ++digits[position] ) {
+                digits[position] = 0;
+                email[position] = alphabet[0];
+                ++position;
+            }
+            if ( length == position ) {
+                break;
+            } else {}
+            email[position] = alphabet[digits[position]];
+        }
+    }
+}
+
+void compare_every_byte_at_every_position() {
+    const std::string valid = "ab.c@de-f.gh";
+    for ( size_t position = 0; position < valid.size(); ++position ) {
+        for ( int byte = 0; byte < 256; ++byte ) {
+            std::string email = valid;
+            email[position] = static_cast< char >( byte );
+            compare( email );
+        }
+    }
+}
+
+/// Linear congruential generator, so random corpus doesn't depend on standard library.
+struct random_numbers {
+    random_numbers() : state( 20101028 ) {}
+
+    size_t state;
+public:
+    size_t next( size_t limit ) {
+        state = state * 1103515245 + 12345;
+        return ( state / 65536 ) % limit;
+    }
+};
+
+void compare_random_strings_near_valid_emails() {
+    const char near[] = "abZ09_.-.@";
+    const size_t near_size = sizeof( near ) - 1;
+    const char anything[] = "ab9Z_.-@.x \n\t+\xe9";
+    const size_t anything_size = sizeof( anything ) - 1;
+    random_numbers random;
+    for ( size_t i = 0; i < random_samples_quantity; ++i ) {
+        std::string email;
+        for ( size_t length = random.next( 6 ); length > 0; --length ) {
+            email += near[random.next( near_size - 1 )];
+        }
+        email += '@';
+        for ( size_t length = random.next( 14 ); length > 0; --length ) {
+            email += near[random.next( near_size )];
+        }
+        if ( 0 == random.next( 4 ) ) {
+            email[random.next( email.size() )] = anything[random.next( anything_size )];
+        } else {}
+        compare( email );
+    }
+}
+
+int main() {
+    compare_edge_cases();
+    compare_all_short_strings();
+    compare_every_byte_at_every_position();
+    compare_random_strings_near_valid_emails();
+
+    std::cout << checked << " strings checked, " << accepted << " accepted, "
+              << differences << " differences" << std::endl;
+    return 0 == differences ? 0 : 1;
+}
@@ -0,0 +1,83 @@
+// Check of floating values acceptance.
+//
+// Floating value is converted via 'std::from_chars' in C++17 and via lexical_cast in older
+// standards, and the same command line must be correct (or incorrect) in both cases: leading plus
+// is accepted, underflow (non-zero value converted into zero or subnormal number) and overflow
+// are rejected. Build and run it with both standards. Returns non-zero if some value is
+// accepted (or rejected) unexpectedly.
+//
+// Build (for example):
+// g++ -std=c++17 -O2 -I.. floating_conversion_check.cpp -lboost_filesystem -lboost_system
+// g++ -std=c++11 -O2 -I.. floating_conversion_check.cpp -lboost_filesystem -lboost_system
+
+#include <clpp/parser.hpp>
+
+#include <iostream>
+#include <string>
+
+size_t failures = 0;
+
+/// \struct sample
+/// \brief Inputed value and its expected acceptance for 'double' and 'float' parameters.
+struct sample {
+    const char* value;
+    bool        correct_double;
+    bool        correct_float;
+};
+
+const sample samples[] = {
+    { "1.5",        true,   true }
+    , { "+1.5",     true,   true }
+    , { "-1.5",     true,   true }
+    , { ".5",       true,   true }
+    , { "5.",       true,   true }
+    , { "0",        true,   true }
+    , { "0.0",      true,   true }
+    , { "0e-500",   true,   true }
+    , { "inf",      true,   true }
+    , { "-inf",     true,   true }
+    , { "3.5e38",   true,   false }
+    , { "1e-38",    true,   false }
+    , { "1e-45",    true,   false }
+    , { "1e-310",   false,  false }
+    , { "4e-320",   false,  false }
+    , { "1e-400",   false,  false }
+    , { "-1e-400",  false,  false }
+    , { "1e400",    false,  false }
+    , { "-1e400",   false,  false }
+    , { "+-1",      false,  false }
+    , { "1e",       false,  false }
+    , { "1.5x",     false,  false }
+};
+
+template< typename FloatingType >
+void check( const std::string& type_name, const char* value, bool expected ) {
+    FloatingType variable = 7;
+    clpp::command_line_parameters_parser parser;
+    parser.add_parameter( "-f", &variable );
+
+    const std::string parameter = std::string( "-f=" ) + value;
+    char program[] = "program";
+    char* argv[] = { program, const_cast< char* >( parameter.c_str() ) };
+    bool accepted = true;
+    try {
+        parser.parse( 2, argv );
+    } catch ( const std::exception& /* exc */ ) {
+        accepted = false;
+    }
+    if ( accepted != expected ) {
+        std::cout << "FAILED: '" << value << "' is " << ( accepted ? "accepted" : "rejected" )
+                  << " for '" << type_name << "'" << std::endl;
+        ++failures;
+    } else {}
+}
+
+int main() {
+    for ( size_t i = 0; i < sizeof( samples ) / sizeof( samples[0] ); ++i ) {
+        check< double >( "double", samples[i].value, samples[i].correct_double );
+        check< float >( "float", samples[i].value, samples[i].correct_float );
+    }
+    std::cout << ( 0 == failures ? "ok: " : "FAILED: " ) << __cplusplus << ", "
+              << sizeof( samples ) / sizeof( samples[0] ) << " values" << std::endl;
+    return 0 == failures ? 0 : 1;
+}
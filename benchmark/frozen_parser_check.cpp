@@ -0,0 +1,110 @@
+// Check of frozen parser's immutability.
+//
+// After 'freeze()' lookup tables of parser are built, so every change that would make them
+// stale must be rejected: registration of new parameter, change of name-value separator,
+// and change of settings of already registered parameter ('necessary()', 'default_value()',
+// 'order()', 'check_semantic()'). Returns non-zero if some change is accepted.
+//
+// Build (for example):
+// g++ -O2 -I.. frozen_parser_check.cpp -lboost_filesystem -lboost_system
+
+#include <clpp/parser.hpp>
+
+#include <iostream>
+
+void some_flag() {}
+void some_num( int /* number */ ) {}
+void some_str( const std::string& /* str */ ) {}
+
+size_t failures = 0;
+
+template< typename Change >
+void expect_rejection( const std::string& what, Change change ) {
+    try {
+        change();
+        std::cout << "FAILED: " << what << " is accepted by frozen parser" << std::endl;
+        ++failures;
+    } catch ( const std::logic_error& /* exc */ ) {
+        std::cout << "ok: " << what << " is rejected" << std::endl;
+    }
+}
+
+/// Reference to parameter is valid until next registration, so kept one is registered last.
+clpp::parameter& register_parameters( clpp::command_line_parameters_parser& parser ) {
+    parser.add_parameter( "-h", "--help", some_flag );
+    parser.add_parameter( "-s", "--str", some_str );
+    return parser.add_parameter( "-n", "--num", some_num );
+}
+
+struct frozen_parser {
+    frozen_parser() :
+            num( register_parameters( parser ) ) {
+        parser.freeze();
+    }
+
+    clpp::command_line_parameters_parser    parser;
+    clpp::parameter&                        num;
+};
+
+struct registration {
+    explicit registration( frozen_parser& _p ) : p( _p ) {}
+    frozen_parser& p;
+    void operator()() const { p.parser.add_parameter( "-v", "--verbose", some_flag ); }
+};
+
+struct separator_change {
+    explicit separator_change( frozen_parser& _p ) : p( _p ) {}
+    frozen_parser& p;
+    void operator()() const { p.parser.set_value_separator( ':' ); }
+};
+
+struct necessity {
+    explicit necessity( frozen_parser& _p ) : p( _p ) {}
+    frozen_parser& p;
+    void operator()() const { p.num.necessary(); }
+};
+
+struct default_value {
+    explicit default_value( frozen_parser& _p ) : p( _p ) {}
+    frozen_parser& p;
+    void operator()() const { p.num.default_value( 1 ); }
+};
+
+struct order {
+    explicit order( frozen_parser& _p ) : p( _p ) {}
+    frozen_parser& p;
+    void operator()() const { p.num.order( 1 ); }
+};
+
+struct semantic {
+    explicit semantic( frozen_parser& _p ) : p( _p ) {}
+    frozen_parser& p;
+    void operator()() const { p.num.check_semantic( clpp::ipv4 ); }
+};
+
+/// Rejected changes don't touch parameter, so parsing is the same as before them.
+void check_parsing( frozen_parser& p ) {
+    char program[] = "program";
+    char num[] = "-n=1";
+    char str[] = "-s=not-an-address";
+    char* argv[] = { program, num, str };
+    try {
+        p.parser.parse( 3, argv );
+        std::cout << "ok: parsing is not changed" << std::endl;
+    } catch ( const std::exception& exc ) {
+        std::cout << "FAILED: parsing after rejected changes: " << exc.what() << std::endl;
+        ++failures;
+    }
+}
+
+int main() {
+    frozen_parser p;
+    expect_rejection( "registration of parameter", registration( p ) );
+    expect_rejection( "change of name-value separator", separator_change( p ) );
+    expect_rejection( "'necessary()'", necessity( p ) );
+    expect_rejection( "'default_value()'", default_value( p ) );
+    expect_rejection( "'order()'", order( p ) );
+    expect_rejection( "'check_semantic()'", semantic( p ) );
+    check_parsing( p );
+    return 0 == failures ? 0 : 1;
+}
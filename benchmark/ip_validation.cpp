@@ -0,0 +1,129 @@
+// Microbenchmark of IP address semantic checks.
+//
+// Compares the check of 'ip' semantic via Boost.Asio with exceptions (the way addresses were
+// checked before) with CLPP's own address parsers, on valid, invalid and mixed corpora.
+// Invalid address still causes an exception at the public boundary, so "check" columns include it,
+// "status" column shows pure non-throwing path.
+//
+// Build (for example):
+// g++ -O2 -I.. ip_validation.cpp -lboost_chrono -lboost_filesystem -lboost_system -lpthread
+//
+// Usage:
+// ./ip_validation [--output=results.json] [--quick]
+//
+// Returns non-zero if some address is accepted by one check and rejected by another.
+
+#include "benchmark.hpp"
+
+#include <clpp/detail/checkers/validators.hpp>
+
+#include <boost/asio/ip/address_v4.hpp>
+#include <boost/asio/ip/address_v6.hpp>
+
+#include <stdexcept>
+
+typedef std::vector< std::string > corpus;
+
+/// Check of 'ip' semantic as it was implemented via Boost.Asio.
+void asio_check_ip_validity( const std::string& address ) {
+    try {
+        boost::asio::ip::address_v4::from_string( address );
+    } catch ( const std::exception& /* exc */ ) {
+        try {
+            boost::asio::ip::address_v6::from_string( address );
+        } catch ( const std::exception& /* exc */ ) {
+            throw std::invalid_argument( "invalid IP" );
+        }
+    }
+}
+
+corpus valid_addresses() {
+    const char* samples[] = { "127.0.0.1", "192.168.100.254", "8.8.8.8", "10.0.0.1",
+                              "::1", "fe80::1%eth0", "2001:db8:85a3::8a2e:370:7334", 
+                              "::ffff:192.0.2.128", "1:2:3:4:5:6:7:8" };
+    return corpus( samples, samples + sizeof( samples ) / sizeof( samples[0] ) );
+}
+
+corpus invalid_addresses() {
+    const char* samples[] = { "256.0.0.1", "192.168.1", "01.2.3.4", "localhost", "1.2.3.4.5",
+                              "1::2::3", "2001:db8:85a3:0:0:8a2e:370:7334:1", "fe80::g", "" };
+    return corpus( samples, samples + sizeof( samples ) / sizeof( samples[0] ) );
+}
+
+corpus mixed_addresses() {
+    corpus addresses = valid_addresses();
+    const corpus invalid = invalid_addresses();
+    addresses.insert( addresses.end(), invalid.begin(), invalid.end() );
+    return addresses;
+}
+
+template< typename Check >
+double check_time_in_ns( const corpus& addresses, size_t rounds, Check check, size_t& incorrect ) {
+    const clock_type::time_point start = clock_type::now();
+    for ( size_t round = 0; round < rounds * 10000; ++round ) {
+        for ( size_t i = 0; i < addresses.size(); ++i ) {
+            try {
+                check( addresses[i] );
+            } catch ( const std::exception& /* exc */ ) {
+                ++incorrect;
+            }
+        }
+    }
+    return nanoseconds_since( start ) / static_cast< double >( rounds * 10000 * addresses.size() );
+}
+
+double status_time_in_ns( const corpus& addresses, size_t rounds, size_t& incorrect ) {
+    const clock_type::time_point start = clock_type::now();
+    for ( size_t round = 0; round < rounds * 10000; ++round ) {
+        for ( size_t i = 0; i < addresses.size(); ++i ) {
+            if ( !clpp::detail::ipv4_address_is_valid( addresses[i] ) 
+                 && !clpp::detail::ipv6_address_is_valid( addresses[i] ) ) {
+                ++incorrect;
+            } else {}
+        }
+    }
+    return nanoseconds_since( start ) / static_cast< double >( rounds * 10000 * addresses.size() );
+}
+
+/// Incorrect address is reported like in parsing.
+void clpp_check_ip_validity( const std::string& address ) {
+    if ( !clpp::detail::value_semantic_is_correct( clpp::ip, address ) ) {
+        throw std::invalid_argument( clpp::detail::semantic_error_report( clpp::ip, address, "--ip" ) );
+    } else {}
+}
+
+/// Returns false if quantities of incorrect addresses are different.
+bool compare( const std::string&            corpus_name
+              , const corpus&               addresses
+              , const benchmark_options&    options
+              , measurements&               results ) {
+    const size_t rounds = options.scaled( 20 );
+    size_t asio_incorrect = 0;
+    size_t clpp_incorrect = 0;
+    size_t status_incorrect = 0;
+    add_measurement( results, corpus_name, "asio_check", 0, 0
+                     , check_time_in_ns( addresses, rounds, asio_check_ip_validity, asio_incorrect ), "ns_per_check" );
+    add_measurement( results, corpus_name, "clpp_check", 0, 0
+                     , check_time_in_ns( addresses, rounds, clpp_check_ip_validity, clpp_incorrect ), "ns_per_check" );
+    add_measurement( results, corpus_name, "clpp_status", 0, 0
+                     , status_time_in_ns( addresses, rounds, status_incorrect ), "ns_per_check" );
+    if ( asio_incorrect != clpp_incorrect || clpp_incorrect != status_incorrect ) {
+        std::cerr << corpus_name << ": results of checks are DIFFERENT" << std::endl;
+        return false;
+    } else {}
+    return true;
+}
+
+int main( int argc, char* argv[] ) {
+    benchmark_options options;
+    if ( !obtain_options( argc, argv, options ) ) {
+        return 1;
+    } else {}
+
+    measurements results;
+    bool same = compare( "valid", valid_addresses(), options, results );
+    same = compare( "invalid", invalid_addresses(), options, results ) && same;
+    same = compare( "mixed", mixed_addresses(), options, results ) && same;
+    write_results( "ip_validation", results, options );
+    return same ? 0 : 1;
+}
@@ -0,0 +1,89 @@
+// Microbenchmark of numeric values conversion.
+//
+// Compares conversion of inputed values used by CLPP with boost::lexical_cast
+// (the way values were converted before), for integer and floating types.
+//
+// Build (for example, C++17 is needed for floating conversion via std::from_chars):
+// g++ -std=c++17 -O2 -I.. numeric_conversion.cpp -lboost_chrono -lboost_filesystem -lboost_system
+//
+// Usage:
+// ./numeric_conversion [--output=results.json] [--quick]
+//
+// Returns non-zero if results of conversions are different.
+
+#include "benchmark.hpp"
+
+#include <clpp/detail/value_converter.hpp>
+
+#include <boost/lexical_cast.hpp>
+
+template< typename Number >
+std::vector< std::string > values_for_conversion() {
+    std::vector< std::string > values;
+    for ( size_t i = 0; i < 100000; ++i ) {
+        values.push_back( boost::lexical_cast< std::string >( static_cast< Number >( i * 7919 % 30000 ) / 
+                                                              static_cast< Number >( 3 ) ) );
+    }
+    return values;
+}
+
+template< typename Number >
+double lexical_cast_time_in_ns( const std::vector< std::string >& values, size_t rounds, Number& sum ) {
+    const clock_type::time_point start = clock_type::now();
+    for ( size_t round = 0; round < rounds; ++round ) {
+        for ( size_t i = 0; i < values.size(); ++i ) {
+            try {
+                sum += boost::lexical_cast< Number >( values[i].data(), values[i].size() );
+            } catch ( const boost::bad_lexical_cast& /* exc */ ) {}
+        }
+    }
+    return nanoseconds_since( start );
+}
+
+template< typename Number >
+double clpp_conversion_time_in_ns( const std::vector< std::string >& values, size_t rounds, Number& sum ) {
+    const clock_type::time_point start = clock_type::now();
+    for ( size_t round = 0; round < rounds; ++round ) {
+        for ( size_t i = 0; i < values.size(); ++i ) {
+            Number number = 0;
+            if ( clpp::detail::convert_value( clpp::detail::str_view( values[i] ), number ) ) {
+                sum += number;
+            } else {}
+        }
+    }
+    return nanoseconds_since( start );
+}
+
+/// Returns false if sums of converted values are different.
+template< typename Number >
+bool compare( const std::string& type_name, const benchmark_options& options, measurements& results ) {
+    const std::vector< std::string > values = values_for_conversion< Number >();
+    const size_t rounds = options.scaled( 20 );
+    const double conversions = static_cast< double >( rounds * values.size() );
+    Number lexical_cast_sum = 0;
+    Number clpp_sum = 0;
+    add_measurement( results, type_name, "lexical_cast", 0, 0
+                     , lexical_cast_time_in_ns( values, rounds, lexical_cast_sum ) / conversions, "ns_per_conversion" );
+    add_measurement( results, type_name, "clpp", 0, 0
+                     , clpp_conversion_time_in_ns( values, rounds, clpp_sum ) / conversions, "ns_per_conversion" );
+    if ( lexical_cast_sum != clpp_sum ) {
+        std::cerr << type_name << ": results of conversions are DIFFERENT" << std::endl;
+        return false;
+    } else {}
+    return true;
+}
+
+int main( int argc, char* argv[] ) {
+    benchmark_options options;
+    if ( !obtain_options( argc, argv, options ) ) {
+        return 1;
+    } else {}
+
+    measurements results;
+    bool same = compare< int >( "int", options, results );
+    same = compare< unsigned long int >( "unsigned long", options, results ) && same;
+    same = compare< double >( "double", options, results ) && same;
+    same = compare< float >( "float", options, results ) && same;
+    write_results( "numeric_conversion", results, options );
+    return same ? 0 : 1;
+}
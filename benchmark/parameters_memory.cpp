@@ -0,0 +1,145 @@
+// Report of memory per registered parameter.
+//
+// Registers 10 thousand parameters of every kind (flag, value with function, value 
+// with function-member, value with default, value bound to variable) and reports 
+// heap memory per parameter (registration and freezing), and size of parameter's record.
+// Allocated memory includes memory freed during registration (for example, old buffers
+// of growing containers), retained memory is memory kept by frozen parser.
+//
+// Figures before the change of parameter's record (holder in parser's storage instead of
+// shared holder per parameter) are printed side by side with current ones. They were measured
+// by this report on the tree before that change (g++ 12.2, C++17), retained memory wasn't measured then.
+//
+// Build (for example):
+// g++ -O2 -I.. parameters_memory.cpp -lboost_chrono -lboost_filesystem -lboost_system
+//
+// Usage:
+// ./parameters_memory [--output=results.json] [--quick]
+
+#include "benchmark.hpp"
+#include "allocation_counter.hpp"
+
+#include <boost/foreach.hpp>
+
+const size_t parameters_quantity = 10000;
+
+struct settings {
+    void set_name( const std::string& /* name */ ) {}
+};
+
+int some_variable = 0;
+
+/// Names are long enough, so they are not in small buffer of std::string 
+/// (the same for all kinds of parameters). Names are created before measurement.
+std::vector< std::string > option_names() {
+    std::vector< std::string > names;
+    for ( size_t number = 0; number < parameters_quantity; ++number ) {
+        names.push_back( "--some-option-" + clpp::detail::to_str( number ) );
+    }
+    return names;
+}
+
+enum parameter_kind {
+    flag
+    , value_with_function
+    , value_with_function_member
+    , value_with_default
+    , value_bound_to_variable
+};
+
+void register_parameter( clpp::command_line_parameters_parser&  parser
+                         , parameter_kind                       kind
+                         , const std::string&                   name
+                         , settings&                            some_options ) {
+    switch ( kind ) {
+        case flag:                          parser.add_parameter( name, some_flag );                             break;
+        case value_with_function:           parser.add_parameter( name, some_num );                              break;
+        case value_with_function_member:    parser.add_parameter( name, &some_options, &settings::set_name );    break;
+        case value_with_default:            parser.add_parameter( name, some_num ).default_value( 1 );           break;
+        case value_bound_to_variable:       parser.add_parameter( name, &some_variable );                        break;
+    }
+}
+
+/// \struct figures_before_change
+/// \brief Memory per parameter before the change of parameter's record.
+struct figures_before_change {
+    const char* name;
+    double      bytes;
+    double      allocations;
+};
+
+const double record_size_before_change = 144;
+
+const figures_before_change before_change[] = {
+    { "flag",                           642.244,    4.6275 }
+    , { "value_with_function",          722.244,    5.6275 }
+    , { "value_with_function_member",   754.244,    5.6275 }
+    , { "value_with_default",           764.458,    6.629 }
+    , { "value_bound_to_variable",      698.244,    5.6275 }
+};
+
+double measured( const measurements& results, const std::string& name, const std::string& metric ) {
+    BOOST_FOREACH ( const measurement& result, results ) {
+        if ( name == result.name && metric == result.metric ) {
+            return result.value;
+        } else {}
+    }
+    return 0;
+}
+
+void print_comparison( const measurements& results ) {
+    std::cout << "per parameter, before and after the change:" << std::endl
+              << "record: " << record_size_before_change << " -> " 
+              << measured( results, "parameter", "bytes" ) << " bytes" << std::endl;
+    BOOST_FOREACH ( const figures_before_change& before, before_change ) {
+        std::cout << before.name << ": " 
+                  << before.bytes << " -> " << measured( results, before.name, "bytes_per_parameter" ) 
+                  << " bytes, "
+                  << before.allocations << " -> " << measured( results, before.name, "allocations_per_parameter" ) 
+                  << " allocations" << std::endl;
+    }
+}
+
+void measure( const std::string& name, parameter_kind kind, measurements& results ) {
+    settings some_options;
+    const std::vector< std::string > names = option_names();
+    const size_t bytes_before = allocated_bytes;
+    const size_t allocations_before = allocations;
+    const size_t live_bytes_before = live_bytes;
+    size_t retained_bytes = 0;
+    {
+        clpp::command_line_parameters_parser parser;
+        for ( size_t number = 0; number < parameters_quantity; ++number ) {
+            register_parameter( parser, kind, names[number], some_options );
+        }
+        parser.freeze();
+        retained_bytes = live_bytes - live_bytes_before;
+    }
+    const double bytes = static_cast< double >( allocated_bytes - bytes_before );
+    const double quantity = static_cast< double >( allocations - allocations_before );
+    const double parameters = static_cast< double >( parameters_quantity );
+    add_measurement( results, "registration", name, parameters_quantity, 0, bytes / parameters, "bytes_per_parameter" );
+    add_measurement( results, "registration", name, parameters_quantity, 0
+                     , quantity / parameters, "allocations_per_parameter" );
+    add_measurement( results, "registration", name, parameters_quantity, 0
+                     , static_cast< double >( retained_bytes ) / parameters, "retained_bytes_per_parameter" );
+}
+
+/// Memory doesn't depend on duration, so '--quick' changes nothing.
+int main( int argc, char* argv[] ) {
+    benchmark_options options;
+    if ( !obtain_options( argc, argv, options ) ) {
+        return 1;
+    } else {}
+
+    measurements results;
+    add_measurement( results, "record", "parameter", 0, 0, static_cast< double >( sizeof( clpp::parameter ) ), "bytes" );
+    measure( "flag", flag, results );
+    measure( "value_with_function", value_with_function, results );
+    measure( "value_with_function_member", value_with_function_member, results );
+    measure( "value_with_default", value_with_default, results );
+    measure( "value_bound_to_variable", value_bound_to_variable, results );
+    print_comparison( results );
+    write_results( "parameters_memory", results, options );
+    return 0;
+}
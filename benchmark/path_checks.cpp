@@ -0,0 +1,110 @@
+// Benchmark of 'path' semantic checks on slow filesystem.
+//
+// Creates local directory tree and checks paths in it through existence function
+// with injected latency (every check sleeps, like 'stat' on network filesystem).
+// Compares sequential checks, concurrent checks, and concurrent checks in frozen parser
+// (where results are memoized, so next parsings don't touch filesystem at all).
+//
+// Build (for example):
+// g++ -O2 -I.. path_checks.cpp -lboost_thread -lboost_chrono -lboost_filesystem -lboost_system -lpthread
+//
+// Usage:
+// ./path_checks [--output=results.json] [--quick]
+
+#include "benchmark.hpp"
+
+#include <clpp/concurrent_path_checks.hpp>
+
+#include <boost/thread/thread.hpp>
+#include <boost/atomic.hpp>
+
+const size_t inputed_paths_quantity = 32;
+const size_t default_paths_quantity = 8;
+const std::string tree_root = "path_checks_tree";
+
+boost::atomic< size_t > existence_checks( 0 );
+
+/// Slow 'stat', without FUSE: latency is injected before real check.
+bool slow_path_exists( const std::string& path ) {
+    ++existence_checks;
+    boost::this_thread::sleep_for( boost::chrono::milliseconds( 2 ) );
+    return clpp::detail::path_exists_in_filesystem( path );
+}
+
+std::string path_in_tree( size_t number ) {
+    return tree_root + "/dir-" + clpp::detail::to_str( number % 4 ) + "/file-" + clpp::detail::to_str( number );
+}
+
+void create_tree() {
+    for ( size_t number = 0; number < inputed_paths_quantity + default_paths_quantity; ++number ) {
+        boost::filesystem::create_directories( boost::filesystem::path( path_in_tree( number ) ).parent_path() );
+        std::ofstream file( path_in_tree( number ).c_str() );
+    }
+}
+
+void register_parameters( clpp::command_line_parameters_parser& parser ) {
+    for ( size_t number = 0; number < inputed_paths_quantity + default_paths_quantity; ++number ) {
+        clpp::detail::parameter& registered = parser.add_parameter( option_name( number ), some_str )
+                                                    .check_semantic( clpp::path );
+        if ( number >= inputed_paths_quantity ) {
+            registered.default_value( path_in_tree( number ) );
+        } else {}
+    }
+}
+
+/// Name of measurement is the number of parsing, so memoization in frozen parser is visible.
+void measure( const std::string&                        name
+              , const clpp::paths_existence_checker&    checker
+              , bool                                    frozen
+              , const benchmark_options&                options
+              , measurements&                           results ) {
+    clpp::command_line_parameters_parser parser;
+    register_parameters( parser );
+    parser.set_paths_existence_checker( checker );
+    if ( frozen ) {
+        parser.freeze();
+    } else {}
+
+    command_line line;
+    for ( size_t number = 0; number < inputed_paths_quantity; ++number ) {
+        line.add( option_name( number ) + "=" + path_in_tree( number ) );
+    }
+    const size_t registered = inputed_paths_quantity + default_paths_quantity;
+    const size_t parsings_quantity = options.quick ? 2 : 5;
+    for ( size_t i = 0; i < parsings_quantity; ++i ) {
+        existence_checks = 0;
+        const clock_type::time_point start = clock_type::now();
+        parser.parse( line.argc(), line.argv() );
+        const double milliseconds = nanoseconds_since( start ) / 1e6;
+        const std::string parsing = "parsing_" + clpp::detail::to_str( i + 1 );
+        add_measurement( results, name, parsing, registered, inputed_paths_quantity, milliseconds, "ms" );
+        add_measurement( results, name, parsing, registered, inputed_paths_quantity
+                         , static_cast< double >( existence_checks.load() ), "existence_checks" );
+    }
+}
+
+int main( int argc, char* argv[] ) {
+    benchmark_options options;
+    if ( !obtain_options( argc, argv, options ) ) {
+        return 1;
+    } else {}
+
+    create_tree();
+
+    const clpp::sequential_paths_existence_checker sequential( slow_path_exists );
+    const clpp::concurrent_paths_existence_checker concurrent( 16, slow_path_exists );
+    measurements results;
+    bool measured = true;
+    try {
+        measure( "sequential", sequential, false, options, results );
+        measure( "concurrent", concurrent, false, options, results );
+        measure( "concurrent_frozen", concurrent, true, options, results );
+        write_results( "path_checks", results, options );
+    } catch ( const std::exception& exc ) {
+        std::cerr << exc.what() << std::endl;
+        measured = false;
+    }
+
+    boost::filesystem::remove_all( tree_root );
+    return measured ? 0 : 1;
+}
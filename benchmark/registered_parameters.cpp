@@ -0,0 +1,71 @@
+// Benchmark of parse cost as the quantity of registered parameters grows.
+//
+// Registers N parameters with value, freezes parser once and parses the same ten inputed
+// parameters many times with one reused context, so the result shows how steady-state parsing 
+// (name lookup included) scales with the size of registry. Registration and building of lookup 
+// tables are not measured here (see 'suite.cpp').
+//
+// Build (for example):
+// g++ -O2 -I.. registered_parameters.cpp -lboost_filesystem -lboost_system -lboost_chrono
+//
+// Usage:
+// ./registered_parameters [--output=results.json] [--quick]
+
+#include "benchmark.hpp"
+
+void register_parameters( clpp::command_line_parameters_parser& parser, size_t quantity ) {
+    for ( size_t i = 0; i < quantity; ++i ) {
+        const std::string number = clpp::detail::to_str( i );
+        parser.add_parameter( "-p" + number, "--parameter-" + number, some_num );
+    }
+}
+
+void fill_command_line( size_t registered_quantity, command_line& line ) {
+    const size_t inputed_quantity = std::min< size_t >( 10, registered_quantity );
+    const size_t step = registered_quantity / inputed_quantity;
+    for ( size_t i = 0; i < inputed_quantity; ++i ) {
+        line.add( "--parameter-" + clpp::detail::to_str( i * step ) + "=1" );
+    }
+}
+
+double parse_time_in_ns( size_t registered_quantity, const benchmark_options& options ) {
+    command_line line;
+    fill_command_line( registered_quantity, line );
+
+    clpp::command_line_parameters_parser parser;
+    register_parameters( parser, registered_quantity );
+    parser.freeze();
+    clpp::parse_context context;
+
+    const size_t parsings_per_sample = options.scaled( 20000 );
+    for ( size_t i = 0; i < parsings_per_sample; ++i ) {
+        parser.parse( line.argc(), line.argv(), context );
+    }
+
+    const size_t samples_quantity = options.quick ? 5 : 15;
+    std::vector< double > samples;
+    for ( size_t i = 0; i < samples_quantity; ++i ) {
+        const clock_type::time_point start = clock_type::now();
+        for ( size_t j = 0; j < parsings_per_sample; ++j ) {
+            parser.parse( line.argc(), line.argv(), context );
+        }
+        samples.push_back( nanoseconds_since( start ) / static_cast< double >( parsings_per_sample ) );
+    }
+    return median( samples );
+}
+
+int main( int argc, char* argv[] ) {
+    benchmark_options options;
+    if ( !obtain_options( argc, argv, options ) ) {
+        return 1;
+    } else {}
+
+    const size_t quantities[] = { 10, 100, 1000, 10000 };
+    measurements results;
+    for ( size_t i = 0; i < sizeof( quantities ) / sizeof( quantities[0] ); ++i ) {
+        add_measurement( results, "registry", "parsing", quantities[i], std::min< size_t >( 10, quantities[i] )
+                         , parse_time_in_ns( quantities[i], options ) );
+    }
+    write_results( "registered_parameters", results, options );
+    return 0;
+}
@@ -0,0 +1,86 @@
+// Benchmark of parsing with response file.
+//
+// Generates response files with 10 thousand, 100 thousand and 1 million parameters
+// and parses them with frozen parser. Time per parameter must not grow with size of file
+// (expansion is linear), and heap memory per parameter must not grow too: parameters
+// are views into mapped file, only views and tokens are allocated.
+//
+// Build (for example):
+// g++ -O2 -I.. response_files.cpp -lboost_chrono -lboost_filesystem -lboost_system
+//
+// Usage:
+// ./response_files [--output=results.json] [--quick]
+
+#include "benchmark.hpp"
+#include "allocation_counter.hpp"
+
+#include <clpp/timing_instrumentation.hpp>
+
+#include <cstdio>
+
+void register_parameters( clpp::command_line_parameters_parser& parser, size_t quantity ) {
+    for ( size_t number = 0; number < quantity; ++number ) {
+        parser.add_parameter( option_name( number ), some_num );
+    }
+    parser.allow_response_files();
+    parser.freeze();
+}
+
+/// Every tenth parameter is quoted, so part of file is unquoted in place.
+void generate_response_file( const std::string& path, size_t quantity ) {
+    std::ofstream file( path.c_str() );
+    for ( size_t number = 0; number < quantity; ++number ) {
+        if ( 0 == number % 10 ) {
+            file << '"' << option_name( number ) << '=' << number << "\"\n";
+        } else {
+            file << option_name( number ) << '=' << number << '\n';
+        }
+    }
+}
+
+void measure( size_t quantity, measurements& results ) {
+    const std::string path = "response_file.rsp";
+    generate_response_file( path, quantity );
+    const double file_size = static_cast< double >( boost::filesystem::file_size( path ) );
+
+    clpp::command_line_parameters_parser parser;
+    register_parameters( parser, quantity );
+
+    std::string response_file = "@" + path;
+    char* argv[] = { const_cast< char* >( "program" ), &response_file[0], 0 };
+    clpp::parse_context context;
+    clpp::timing_instrumentation timings;
+
+    const size_t bytes_before = allocated_bytes;
+    const clock_type::time_point start = clock_type::now();
+    parser.parse( 2, argv, context, timings );
+    const double parsing_nanoseconds = nanoseconds_since( start );
+    const double parsing_bytes = static_cast< double >( allocated_bytes - bytes_before );
+
+    const double expansion_nanoseconds = static_cast< double >( timings.phases[clpp::obtaining_phase].nanoseconds );
+    const double parameters = static_cast< double >( quantity );
+    add_measurement( results, "response_file", "file", quantity, quantity, file_size / parameters, "bytes_per_parameter" );
+    add_measurement( results, "response_file", "expansion", quantity, quantity
+                     , expansion_nanoseconds / parameters, "ns_per_parameter" );
+    add_measurement( results, "response_file", "parsing", quantity, quantity
+                     , parsing_nanoseconds / parameters, "ns_per_parameter" );
+    add_measurement( results, "response_file", "heap", quantity, quantity, parsing_bytes / parameters, "bytes_per_parameter" );
+
+    std::remove( path.c_str() );
+}
+
+int main( int argc, char* argv[] ) {
+    benchmark_options options;
+    if ( !obtain_options( argc, argv, options ) ) {
+        return 1;
+    } else {}
+
+    measurements results;
+    measure( 10000, results );
+    measure( 100000, results );
+    if ( !options.quick ) {
+        measure( 1000000, results );
+    } else {}
+    write_results( "response_files", results, options );
+    return 0;
+}
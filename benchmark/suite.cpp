@@ -0,0 +1,315 @@
+// Benchmark suite of registration and parsing.
+//
+// Measures registration cost and parse cost on synthetic schemas (10, 1000 and 100000 parameters),
+// parse cost for every supported value type and every value semantic, for unnamed parameters
+// for default values and for list values. Results are written in JSON (the same records as
+// other benchmarks write, see 'benchmark.hpp'), so results of different releases can be compared by scripts.
+//
+// Build (for example):
+// g++ -O2 -I.. suite.cpp -lboost_chrono -lboost_filesystem -lboost_system
+//
+// Usage:
+// ./suite [--output=results.json] [--quick]
+//
+// Without '--output' results are written to standard output. With '--quick' the biggest schema
+// is skipped and every measurement is shorter (for smoke runs).
+
+#include "benchmark.hpp"
+
+template< typename ArgType >
+void take_value( const ArgType& /* value */ ) {}
+
+void take_flag() {}
+
+/// Every sample lasts at least 'sample_duration', result is median of samples.
+template< typename Operation >
+double ns_per_operation( Operation& operation, const benchmark_options& options ) {
+    const boost::chrono::nanoseconds sample_duration( options.quick ? 2000000 : 20000000 );
+    const size_t samples_quantity = options.quick ? 3 : 7;
+
+    size_t iterations = 1;
+    for ( ;; ) {
+        const clock_type::time_point start = clock_type::now();
+        for ( size_t i = 0; i < iterations; ++i ) {
+            operation();
+        }
+        if ( clock_type::now() - start >= sample_duration ) {
+            break;
+        } else {}
+        iterations *= 2;
+    }
+
+    std::vector< double > samples;
+    for ( size_t sample = 0; sample < samples_quantity; ++sample ) {
+        const clock_type::time_point start = clock_type::now();
+        for ( size_t i = 0; i < iterations; ++i ) {
+            operation();
+        }
+        samples.push_back( nanoseconds_since( start ) / static_cast< double >( iterations ) );
+    }
+    return median( samples );
+}
+
+/// \struct parsing
+/// \brief Operation: parsing of the same command line with frozen parser.
+struct parsing {
+    parsing( const clpp::command_line_parameters_parser& _parser, command_line& line ) :
+            parser( _parser )
+            , argc( line.argc() )
+            , argv( line.argv() ) {}
+
+    const clpp::command_line_parameters_parser& parser;
+    const int                                   argc;
+    char**                                      argv;
+    clpp::parse_context                         context;
+public:
+    void operator()() { parser.parse( argc, argv, context ); }
+};
+
+/// \struct unfrozen_parsing
+/// \brief Operation: parsing of the same command line with parser that is not frozen.
+struct unfrozen_parsing {
+    unfrozen_parsing( clpp::command_line_parameters_parser& _parser, command_line& line ) :
+            parser( _parser )
+            , argc( line.argc() )
+            , argv( line.argv() ) {}
+
+    clpp::command_line_parameters_parser&   parser;
+    const int                               argc;
+    char**                                  argv;
+public:
+    void operator()() { parser.parse( argc, argv ); }
+};
+
+// Synthetic schemas.
+
+/// Kinds of parameters in schema are repeated in this order.
+enum schema_parameter_kind {
+    flag_parameter
+    , int_parameter
+    , double_parameter
+    , string_parameter
+    , schema_parameter_kinds
+};
+
+schema_parameter_kind kind_of( size_t number ) {
+    return static_cast< schema_parameter_kind >( number % schema_parameter_kinds );
+}
+
+void generate_schema( clpp::command_line_parameters_parser& parser, size_t quantity ) {
+    for ( size_t number = 0; number < quantity; ++number ) {
+        const std::string short_name = "-o" + clpp::detail::to_str( number );
+        switch ( kind_of( number ) ) {
+            case flag_parameter:    parser.add_parameter( short_name, option_name( number ), take_flag );              break;
+            case int_parameter:     parser.add_parameter( short_name, option_name( number ), take_value< int > );      break;
+            case double_parameter:  parser.add_parameter( short_name, option_name( number ), take_value< double > );   break;
+            default:                parser.add_parameter( short_name, option_name( number ), take_value< std::string > ); break;
+        }
+    }
+}
+
+/// Inputed parameters are spread over whole schema.
+void generate_command_line( size_t schema_quantity, size_t inputed_quantity, command_line& line ) {
+    const size_t step = schema_quantity / inputed_quantity;
+    for ( size_t i = 0; i < inputed_quantity; ++i ) {
+        const size_t number = i * step;
+        switch ( kind_of( number ) ) {
+            case flag_parameter:    line.add( option_name( number ) );                  break;
+            case int_parameter:     line.add( option_name( number ) + "=42" );          break;
+            case double_parameter:  line.add( option_name( number ) + "=0.5" );         break;
+            default:                line.add( option_name( number ) + "=some_value" );  break;
+        }
+    }
+}
+
+// Measurements.
+
+/// Registration cost doesn't include destruction of parser.
+void measure_registration( size_t quantity, const benchmark_options& options, measurements& results ) {
+    const size_t samples_quantity = options.quick ? 3 : 5;
+    std::vector< double > registration_samples;
+    std::vector< double > freezing_samples;
+    for ( size_t sample = 0; sample < samples_quantity; ++sample ) {
+        clpp::command_line_parameters_parser parser;
+        const clock_type::time_point start = clock_type::now();
+        generate_schema( parser, quantity );
+        registration_samples.push_back( nanoseconds_since( start ) );
+        const clock_type::time_point registered = clock_type::now();
+        parser.freeze();
+        freezing_samples.push_back( nanoseconds_since( registered ) );
+    }
+    add_measurement( results, "registration", "add_parameter", quantity, 0
+                     , median( registration_samples ) / static_cast< double >( quantity ) );
+    add_measurement( results, "registration", "freeze", quantity, 0, median( freezing_samples ) );
+}
+
+void measure_parsing( size_t quantity, const benchmark_options& options, measurements& results ) {
+    const size_t inputed_quantities[] = { 1, 10, 100 };
+    for ( size_t i = 0; i < sizeof( inputed_quantities ) / sizeof( inputed_quantities[0] ); ++i ) {
+        const size_t inputed_quantity = inputed_quantities[i];
+        if ( inputed_quantity > quantity ) {
+            continue;
+        } else {}
+
+        clpp::command_line_parameters_parser parser;
+        generate_schema( parser, quantity );
+        command_line line;
+        generate_command_line( quantity, inputed_quantity, line );
+
+        if ( quantity <= 1000 ) {
+            unfrozen_parsing operation( parser, line );
+            add_measurement( results, "parsing", "unfrozen", quantity, inputed_quantity
+                             , ns_per_operation( operation, options ) );
+        } else {}
+
+        parser.freeze();
+        parsing operation( parser, line );
+        add_measurement( results, "parsing", "frozen", quantity, inputed_quantity
+                         , ns_per_operation( operation, options ) );
+    }
+}
+
+template< typename ArgType >
+void measure_value_type( const std::string&     type_name
+                         , const std::string&   value
+                         , const benchmark_options& options
+                         , measurements&        results ) {
+    clpp::command_line_parameters_parser parser;
+    parser.add_parameter( "-v", "--value", take_value< ArgType > );
+    parser.freeze();
+    command_line line;
+    line.add( "--value=" + value );
+    parsing operation( parser, line );
+    add_measurement( results, "value_type", type_name, 1, 1, ns_per_operation( operation, options ) );
+}
+
+void measure_value_types( const benchmark_options& options, measurements& results ) {
+    measure_value_type< bool >( "bool", "1", options, results );
+    measure_value_type< char >( "char", "c", options, results );
+    measure_value_type< short int >( "short", "-12345", options, results );
+    measure_value_type< int >( "int", "-1234567", options, results );
+    measure_value_type< unsigned int >( "unsigned int", "1234567", options, results );
+    measure_value_type< long int >( "long", "-123456789012", options, results );
+    measure_value_type< unsigned long int >( "unsigned long", "123456789012", options, results );
+    measure_value_type< float >( "float", "3.14159", options, results );
+    measure_value_type< double >( "double", "2.718281828459045", options, results );
+    measure_value_type< long double >( "long double", "2.718281828459045", options, results );
+    measure_value_type< std::string >( "std::string", "/some/path/to/file.txt", options, results );
+}
+
+void measure_value_semantic( const std::string&         semantic_name
+                             , clpp::value_semantic     semantic
+                             , const std::string&       value
+                             , const benchmark_options&     options
+                             , measurements&            results ) {
+    clpp::command_line_parameters_parser parser;
+    parser.add_parameter( "-v", "--value", take_value< std::string > ).check_semantic( semantic );
+    parser.freeze();
+    command_line line;
+    line.add( "--value=" + value );
+    parsing operation( parser, line );
+    add_measurement( results, "value_semantic", semantic_name, 1, 1, ns_per_operation( operation, options ) );
+}
+
+void measure_value_semantics( const benchmark_options& options, measurements& results ) {
+    measure_value_semantic( "no_semantic", clpp::no_semantic, "some_value", options, results );
+    measure_value_semantic( "path", clpp::path, "/", options, results );
+    measure_value_semantic( "ipv4", clpp::ipv4, "192.168.100.254", options, results );
+    measure_value_semantic( "ipv6", clpp::ipv6, "2001:db8:85a3::8a2e:370:7334", options, results );
+    measure_value_semantic( "ip", clpp::ip, "2001:db8:85a3::8a2e:370:7334", options, results );
+    measure_value_semantic( "email", clpp::email, "some.user@example.com", options, results );
+}
+
+void measure_unnamed_parameters( const benchmark_options& options, measurements& results ) {
+    const size_t quantities[] = { 1, 10 };
+    for ( size_t i = 0; i < sizeof( quantities ) / sizeof( quantities[0] ); ++i ) {
+        clpp::command_line_parameters_parser parser;
+        command_line line;
+        for ( size_t number = 0; number < quantities[i]; ++number ) {
+            parser.add_parameter( option_name( number ), take_value< int > ).order( static_cast< int >( number + 1 ) );
+            line.add( clpp::detail::to_str( 42 + number ) );
+        }
+        parser.freeze();
+        parsing operation( parser, line );
+        add_measurement( results, "unnamed", "ordered", quantities[i], quantities[i]
+                         , ns_per_operation( operation, options ) );
+    }
+}
+
+/// One list parameter, 'inputed' is a quantity of elements in list.
+template< typename ElementType >
+void measure_list( const std::string&     type_name
+                   , const std::string&   element
+                   , const benchmark_options& options
+                   , measurements&        results ) {
+    std::vector< size_t > quantities;
+    quantities.push_back( 10 );
+    quantities.push_back( 1000 );
+    if ( !options.quick ) {
+        quantities.push_back( 100000 );
+    } else {}
+
+    for ( size_t i = 0; i < quantities.size(); ++i ) {
+        clpp::command_line_parameters_parser parser;
+        parser.add_parameter( "-l", "--list", take_value< std::vector< ElementType > > );
+        parser.freeze();
+        std::string value = element;
+        for ( size_t number = 1; number < quantities[i]; ++number ) {
+            value += "," + element;
+        }
+        command_line line;
+        line.add( "--list=" + value );
+        parsing operation( parser, line );
+        add_measurement( results, "list", type_name, 1, quantities[i], ns_per_operation( operation, options ) );
+    }
+}
+
+void measure_lists( const benchmark_options& options, measurements& results ) {
+    measure_list< int >( "int", "-1234567", options, results );
+    measure_list< double >( "double", "2.718281828459045", options, results );
+    measure_list< std::string >( "std::string", "/some/path/to/file.txt", options, results );
+}
+
+/// Nothing inputed: all functions are called with default values.
+void measure_default_values( const benchmark_options& options, measurements& results ) {
+    const size_t quantities[] = { 10, 1000 };
+    for ( size_t i = 0; i < sizeof( quantities ) / sizeof( quantities[0] ); ++i ) {
+        clpp::command_line_parameters_parser parser;
+        for ( size_t number = 0; number < quantities[i]; ++number ) {
+            parser.add_parameter( option_name( number ), take_value< int > ).default_value( 42 );
+        }
+        parser.freeze();
+        command_line line;
+        parsing operation( parser, line );
+        add_measurement( results, "default_value", "dispatch", quantities[i], 0
+                         , ns_per_operation( operation, options ) );
+    }
+}
+
+int main( int argc, char* argv[] ) {
+    benchmark_options options;
+    if ( !obtain_options( argc, argv, options ) ) {
+        return 1;
+    } else {}
+
+    std::vector< size_t > schema_quantities;
+    schema_quantities.push_back( 10 );
+    schema_quantities.push_back( 1000 );
+    if ( !options.quick ) {
+        schema_quantities.push_back( 100000 );
+    } else {}
+
+    measurements results;
+    for ( size_t i = 0; i < schema_quantities.size(); ++i ) {
+        measure_registration( schema_quantities[i], options, results );
+        measure_parsing( schema_quantities[i], options, results );
+    }
+    measure_value_types( options, results );
+    measure_value_semantics( options, results );
+    measure_unnamed_parameters( options, results );
+    measure_default_values( options, results );
+    measure_lists( options, results );
+
+    write_results( "suite", results, options );
+    return 0;
+}
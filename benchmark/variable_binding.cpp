@@ -0,0 +1,122 @@
+// Benchmark of parameters bound to variables against parameters with functions.
+//
+// Registers 1000 parameters with 'int' value in three ways: with function-member, 
+// with free function, and bound to variable. Compares heap memory of registration 
+// per parameter, time of whole parsing per parameter, and time of calling phase 
+// (calling of functions or writing into variables) per parameter, in frozen parser 
+// with reused context.
+//
+// Build (for example):
+// g++ -O2 -I.. variable_binding.cpp -lboost_chrono -lboost_filesystem -lboost_system
+//
+// Usage:
+// ./variable_binding [--output=results.json] [--quick]
+
+#include "benchmark.hpp"
+#include "allocation_counter.hpp"
+
+const size_t parameters_quantity = 1000;
+
+std::vector< int > values( parameters_quantity );
+
+/// Usual storage of values: setter for every parameter.
+struct settings {
+    void set( int value ) { values[0] = value; }
+};
+
+void set_value( int value ) { values[0] = value; }
+
+enum registration_way {
+    with_function_member
+    , with_function
+    , with_variable
+};
+
+void register_parameters( clpp::command_line_parameters_parser& parser, registration_way way, settings& some_options ) {
+    for ( size_t number = 0; number < parameters_quantity; ++number ) {
+        switch ( way ) {
+            case with_function_member:  parser.add_parameter( option_name( number ), &some_options, &settings::set ); break;
+            case with_function:         parser.add_parameter( option_name( number ), set_value );                      break;
+            case with_variable:         parser.add_parameter( option_name( number ), &values[number] );                break;
+        }
+    }
+}
+
+/// Only calling phase is timed (other hooks are empty).
+struct calling_timer : clpp::no_instrumentation {
+    calling_timer() : nanoseconds( 0 ) {}
+
+    void phase_started( clpp::parse_phase phase, const clpp::parse_context& /* context */ ) {
+        if ( clpp::calling_phase == phase ) {
+            start = clock_type::now();
+        } else {}
+    }
+
+    void phase_finished( clpp::parse_phase phase, const clpp::parse_context& /* context */, size_t /* items */ ) {
+        if ( clpp::calling_phase == phase ) {
+            nanoseconds += boost::chrono::duration_cast< boost::chrono::nanoseconds >( clock_type::now() - start ).count();
+        } else {}
+    }
+
+    clock_type::time_point  start;
+    double                  nanoseconds;
+};
+
+void measure( const std::string&            name
+              , registration_way            way
+              , const benchmark_options&    options
+              , measurements&               results ) {
+    settings some_options;
+    const size_t bytes_before = allocated_bytes;
+    clpp::command_line_parameters_parser parser;
+    register_parameters( parser, way, some_options );
+    parser.freeze();
+    const double registration_bytes = static_cast< double >( allocated_bytes - bytes_before );
+
+    command_line line;
+    for ( size_t number = 0; number < parameters_quantity; ++number ) {
+        line.add( option_name( number ) + "=" + clpp::detail::to_str( number ) );
+    }
+    const int argc = line.argc();
+    char** argv = line.argv();
+    const size_t parsings_quantity = options.scaled( 1000 );
+    clpp::parse_context context;
+    parser.parse( argc, argv, context );
+    const clock_type::time_point start = clock_type::now();
+    for ( size_t i = 0; i < parsings_quantity; ++i ) {
+        parser.parse( argc, argv, context );
+    }
+    const double parsing_nanoseconds = nanoseconds_since( start ) / static_cast< double >( parsings_quantity );
+
+    calling_timer timer;
+    for ( size_t i = 0; i < parsings_quantity; ++i ) {
+        parser.parse( argc, argv, context, timer );
+    }
+    const double calling_nanoseconds = timer.nanoseconds / static_cast< double >( parsings_quantity );
+
+    const double parameters = static_cast< double >( parameters_quantity );
+    add_measurement( results, name, "registration", parameters_quantity, parameters_quantity
+                     , registration_bytes / parameters, "bytes_per_parameter" );
+    add_measurement( results, name, "parsing", parameters_quantity, parameters_quantity
+                     , parsing_nanoseconds / parameters, "ns_per_parameter" );
+    add_measurement( results, name, "calling", parameters_quantity, parameters_quantity
+                     , calling_nanoseconds / parameters, "ns_per_parameter" );
+}
+
+int main( int argc, char* argv[] ) {
+    benchmark_options options;
+    if ( !obtain_options( argc, argv, options ) ) {
+        return 1;
+    } else {}
+
+    measurements results;
+    add_measurement( results, "holder", "function", 0, 0
+                     , static_cast< double >( sizeof( clpp::detail::argument_holder< int > ) ), "bytes" );
+    add_measurement( results, "holder", "variable", 0, 0
+                     , static_cast< double >( sizeof( clpp::detail::variable_holder< int, int > ) ), "bytes" );
+    measure( "function_member", with_function_member, options, results );
+    measure( "function", with_function, options, results );
+    measure( "variable", with_variable, options, results );
+    write_results( "variable_binding", results, options );
+    return 0;
+}
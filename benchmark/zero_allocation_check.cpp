@@ -0,0 +1,78 @@
+// Check of parsing without heap allocations.
+//
+// Counts heap allocations (see 'allocation_counter.hpp') and parses with frozen parser and parse
+// context that takes its memory from caller-supplied buffer: with flags, integer values, short
+// strings with semantic checks, unnamed parameter and default value (and with floating value too,
+// if C++17 conversion is available). Every parsing, from the first one, must be done without
+// any heap allocation; returns non-zero otherwise.
+//
+// Build (for example):
+// g++ -O2 -I.. zero_allocation_check.cpp -lboost_filesystem -lboost_system
+
+#include "allocation_counter.hpp"
+
+#include <clpp/parser.hpp>
+
+#include <iostream>
+
+const size_t parsings_quantity = 1000;
+
+long sum = 0;
+
+void some_flag() { ++sum; }
+void some_num( int number ) { sum += number; }
+void some_unsigned( unsigned int number ) { sum += number; }
+void some_str( const std::string& str ) { sum += static_cast< long >( str.size() ); }
+#if defined( CLPP_FLOATING_FROM_CHARS )
+void some_real( double number ) { sum += static_cast< long >( number ); }
+#endif
+
+void register_parameters( clpp::command_line_parameters_parser& parser ) {
+    parser.add_parameter( "-h", "--help", some_flag );
+    parser.add_parameter( "-n", "--number", some_num ).necessary();
+    parser.add_parameter( "-u", "--unsigned", some_unsigned ).default_value( 7u );
+    parser.add_parameter( "-w", "--word", some_str ).order( 1 );
+    parser.add_parameter( "-a", "--address", some_str ).check_semantic( clpp::ip );
+    parser.add_parameter( "-e", "--email", some_str ).check_semantic( clpp::email );
+#if defined( CLPP_FLOATING_FROM_CHARS )
+    parser.add_parameter( "-r", "--real", some_real );
+#endif
+}
+
+/// Strings are short, so they are not allocated by std::string itself.
+char program[]  = "program";
+char word[]     = "word";
+char number[]   = "--number=-42";
+char help[]     = "-h";
+char address[]  = "-a=10.0.0.1";
+char email[]    = "-e=ab@cd.org";
+#if defined( CLPP_FLOATING_FROM_CHARS )
+char real[]     = "--real=2.5";
+char* argv[]    = { program, word, number, help, address, email, real, 0 };
+const int argc  = 7;
+#else
+char* argv[]    = { program, word, number, help, address, email, 0 };
+const int argc  = 6;
+#endif
+
+int main() {
+    clpp::command_line_parameters_parser parser;
+    register_parameters( parser );
+    parser.freeze();
+
+    char buffer[4096];
+    clpp::parse_context context( buffer, sizeof( buffer ) );
+    clpp::diagnostics problems;
+
+    const size_t allocations_before = allocations;
+    bool all_correct = true;
+    for ( size_t i = 0; i < parsings_quantity; ++i ) {
+        parser.parse( argc, argv, context );
+        all_correct = parser.parse( argc, argv, context, problems ) && all_correct;
+    }
+    const size_t parsing_allocations = allocations - allocations_before;
+
+    std::cout << 2 * parsings_quantity << " parsings: " << parsing_allocations << " heap allocations ("
+              << context.heap_allocations() << " by context)" << std::endl;
+    return 0 == parsing_allocations && all_correct ? 0 : 1;
+}
@@ -0,0 +1,227 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+#ifndef CLPP_BATCH_PARSER_HPP
+#define CLPP_BATCH_PARSER_HPP
+
+#include "parser.hpp"
+#include "detail/shell_words_splitter.hpp"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/exception_ptr.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// Status of parsed line.
+enum line_status { 
+    correct_line
+    , incorrect_line
+    , blank_line 
+};
+
+/// \struct line_result
+/// \brief Result of parsing of one line in batch.
+///
+/// Diagnostic is not empty only for incorrect line, it contains reports about all problems in line.
+struct line_result {
+    line_result() : status( blank_line ) {}
+    
+    line_status status;
+    std::string diagnostic;
+};
+
+typedef std::vector< line_result > line_results;
+
+/// \class batch_parser
+/// \brief Parser of many command lines.
+///
+/// Parses text with one command line per line (for example, file with queued jobs)
+/// against frozen parser. First word of every line is a program name (like in 'argv').
+/// Lines are parsed in parallel, worker threads take lines by chunks,
+/// but results are always in the original order of lines.
+///
+/// Every worker parses with its own context with arena, so workers don't compete for heap.
+///
+/// Remember that user's functions are called from worker threads. Any exception from your
+/// function makes its line incorrect. Exception that stops worker thread (for example, 
+/// 'std::bad_alloc' during worker's preparation) is rethrown from parsing function.
+class batch_parser : boost::noncopyable {
+public:
+    explicit batch_parser( const command_line_parameters_parser& _parser
+                           , size_t _threads_quantity = boost::thread::hardware_concurrency() ) :
+            parser( _parser )
+            , threads_quantity( std::max< size_t >( 1, _threads_quantity ) ) {
+        check_frozenness_of_parser();
+    }
+private:
+    const command_line_parameters_parser&   parser;
+    const size_t                            threads_quantity;
+    
+    static size_t lines_per_chunk() { return 1024; }
+
+    /// Per-parse memory of every worker, enough for usual command lines.
+    static size_t arena_size() { return 16 * 1024; }
+private:
+    void check_frozenness_of_parser() const {
+        if ( !parser.is_frozen() ) {
+            const std::string what_happened = lib_prefix() 
+                                              + "Parser must be frozen before batch parsing!";
+            throw std::logic_error( what_happened );
+        } else {}
+    }
+public:
+    /// File is mapped in memory, not read.
+    void parse_file( const std::string& path, line_results& results ) const {
+        results.clear();
+        if ( 0 == boost::filesystem::file_size( path ) ) {
+            return;
+        } else {}
+
+        using namespace boost::interprocess;
+        file_mapping file( path.c_str(), read_only );
+        mapped_region region( file, read_only );
+        region.advise( mapped_region::advice_sequential );
+        const char* begin = static_cast< const char* >( region.get_address() );
+        parse_lines( begin, begin + region.get_size(), results );
+    }
+
+    void parse_lines( const char* begin, const char* end, line_results& results ) const {
+        detail::str_views lines;
+        split_into_lines( begin, end, lines );
+        results.assign( lines.size(), line_result() );
+
+        boost::atomic< size_t > next_line( 0 );
+        failures workers_failures( threads_quantity );
+        boost::thread_group workers;
+        // Started workers use local 'lines', 'next_line', 'results' and 'workers_failures', so they must be 
+        // joined before exception (from thread creation or from work of this thread) leaves frame.
+        try {
+            for ( size_t i = 1; i < threads_quantity; ++i ) {
+                workers.create_thread( boost::bind( &batch_parser::work_in_worker_thread
+                                                    , this
+                                                    , boost::cref( lines )
+                                                    , boost::ref( next_line )
+                                                    , boost::ref( results )
+                                                    , boost::ref( workers_failures[i] ) ) );
+            }
+            work( lines, next_line, results );
+        } catch ( ... ) {
+            workers.join_all();
+            throw;
+        }
+        workers.join_all();
+        rethrow_first_of( workers_failures );
+    }
+private:
+    /// Symbol '\r' before '\n' is ignored, so text with Windows line endings is supported too.
+    void split_into_lines( const char* begin, const char* end, detail::str_views& lines ) const {
+        while ( begin != end ) {
+            const void* new_line = std::memchr( begin, '\n', end - begin );
+            const char* line_end = ( 0 == new_line ) ? end : static_cast< const char* >( new_line );
+            const char* next_line_begin = ( end == line_end ) ? end : line_end + 1;
+            if ( begin != line_end && '\r' == *( line_end - 1 ) ) {
+                --line_end;
+            } else {}
+            lines.push_back( detail::str_view( begin, line_end - begin ) );
+            begin = next_line_begin;
+        }
+    }
+private:
+    typedef std::vector< boost::exception_ptr > failures;
+
+    /// Exception cannot leave worker thread (it would terminate program), so it's passed to calling thread.
+    void work_in_worker_thread( const detail::str_views&     lines
+                                , boost::atomic< size_t >&   next_line
+                                , line_results&              results
+                                , boost::exception_ptr&      failure ) const {
+        try {
+            work( lines, next_line, results );
+        } catch ( ... ) {
+            failure = boost::current_exception();
+        }
+    }
+
+    void rethrow_first_of( const failures& workers_failures ) const {
+        for ( size_t i = 0; i < workers_failures.size(); ++i ) {
+            if ( workers_failures[i] ) {
+                boost::rethrow_exception( workers_failures[i] );
+            } else {}
+        }
+    }
+
+    void work( const detail::str_views&     lines
+               , boost::atomic< size_t >&   next_line
+               , line_results&              results ) const {
+        std::vector< char > arena_memory( arena_size() );
+        parse_context context( &arena_memory[0], arena_memory.size() );
+        diagnostics problems;
+        detail::shell_words_splitter split;
+        for ( ;; ) {
+            const size_t first = next_line.fetch_add( lines_per_chunk() );
+            if ( first >= lines.size() ) {
+                return;
+            } else {}
+            
+            const size_t last = std::min( first + lines_per_chunk(), lines.size() );
+            for ( size_t i = first; i < last; ++i ) {
+                parse_line( lines[i], split, context, problems, results[i] );
+            }
+        }
+    }
+
+    void parse_line( const detail::str_view&          line
+                     , detail::shell_words_splitter&  split
+                     , parse_context&                 context
+                     , diagnostics&                   problems
+                     , line_result&                   result ) const {
+        try {
+            split( line );
+            if ( split.no_words() ) {
+                result.status = blank_line;
+                return;
+            } else {}
+            
+            if ( parser.parse( split.argc(), split.argv(), context, problems ) ) {
+                result.status = correct_line;
+            } else {
+                result.status = incorrect_line;
+                result.diagnostic = problems.report( " " );
+            }
+        } catch ( const std::exception& exc ) {
+            result.status = incorrect_line;
+            result.diagnostic = exc.what();
+        } catch ( ... ) {
+            result.status = incorrect_line;
+            result.diagnostic = lib_prefix() + "Unknown exception during parsing of line!";
+        }
+    }
+};
+
+} // namespace clpp
+
+#endif // CLPP_BATCH_PARSER_HPP
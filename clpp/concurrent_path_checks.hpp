@@ -0,0 +1,210 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+#ifndef CLPP_CONCURRENT_PATH_CHECKS_HPP
+#define CLPP_CONCURRENT_PATH_CHECKS_HPP
+
+#include "parser.hpp"
+
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/bind.hpp>
+
+#include <algorithm>
+#include <list>
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// \class concurrent_paths_existence_checker
+/// \brief Checker of paths existence in parallel.
+///
+/// Useful for slow (for example, network) filesystems: all paths of one parsing
+/// are checked by worker threads at the same time, and parsing waits for the slowest one,
+/// not for the sum of all. Worker threads are created once, with checker, and live as long
+/// as it does, so parsing only submits its paths to them right after tokenizing, and checks
+/// them too (while waiting for its result) after other checks. One checker can be used 
+/// by many parsing threads at once.
+///
+/// Existence function must not throw exceptions. Depends on Boost.Thread.
+class concurrent_paths_existence_checker : public paths_existence_checker, boost::noncopyable {
+    /// \struct job
+    /// \brief Paths of one parsing.
+    struct job {
+        job() :
+                paths( 0 )
+                , existence( 0 )
+                , next_path( 0 )
+                , unchecked_quantity( 0 ) {}
+
+        const detail::str_storage*  paths;
+        detail::existence_marks*    existence;
+        size_t                      next_path;
+        size_t                      unchecked_quantity;
+    };
+    /// List, so job stays in its place while other jobs come and go. Nodes of finished jobs
+    /// are kept for next jobs, so submission doesn't allocate memory (in steady state).
+    typedef std::list< job >    jobs;
+    typedef jobs::iterator      job_it;
+public:
+    explicit concurrent_paths_existence_checker( size_t                     _threads_quantity = 8
+                                                 , path_existence_function  _exists = detail::path_exists_in_filesystem ) :
+            threads_quantity( std::max< size_t >( 1, _threads_quantity ) )
+            , exists( _exists )
+            , stopping( false ) {
+        start_workers();
+    }
+
+    ~concurrent_paths_existence_checker() {
+        stop_workers();
+    }
+private:
+    const size_t                                threads_quantity;
+    const path_existence_function               exists;
+    /// Guards jobs (with their existence marks) and stopping.
+    mutable boost::mutex                        guard;
+    mutable boost::condition_variable           work_appeared;
+    mutable boost::condition_variable           job_finished;
+    mutable jobs                                pending_jobs;
+    mutable jobs                                finished_jobs;
+    bool                                        stopping;
+    boost::thread_group                         workers;
+public:
+    /// Single path is checked right here.
+    void check( const detail::str_storage& paths, detail::existence_marks& existence ) const {
+        if ( paths.size() < 2 ) {
+            check_in_this_thread( paths, existence );
+        } else {
+            boost::unique_lock< boost::mutex > lock( guard );
+            wait_for( submitted( paths, existence, lock ), lock );
+        }
+    }
+
+    /// Paths are checked by workers, even single path (it's checked meanwhile parsing goes on).
+    void start( const detail::str_storage& paths, detail::existence_marks& existence ) const {
+        boost::unique_lock< boost::mutex > lock( guard );
+        submitted( paths, existence, lock );
+    }
+
+    void finish( detail::existence_marks& existence ) const {
+        boost::unique_lock< boost::mutex > lock( guard );
+        for ( job_it it = pending_jobs.begin(); pending_jobs.end() != it; ++it ) {
+            if ( &existence == it->existence ) {
+                wait_for( it, lock );
+                return;
+            } else {}
+        }
+    }
+private:
+    void start_workers() {
+        try {
+            for ( size_t i = 0; i < threads_quantity; ++i ) {
+                workers.create_thread( boost::bind( &concurrent_paths_existence_checker::work, this ) );
+            }
+        } catch ( ... ) {
+            stop_workers();
+            throw;
+        }
+    }
+
+    void stop_workers() {
+        {
+            boost::lock_guard< boost::mutex > lock( guard );
+            stopping = true;
+        }
+        work_appeared.notify_all();
+        workers.join_all();
+    }
+
+    void check_in_this_thread( const detail::str_storage& paths, detail::existence_marks& existence ) const {
+        for ( size_t i = 0; i < paths.size(); ++i ) {
+            existence[i] = exists( paths[i] );
+        }
+    }
+
+    job_it submitted( const detail::str_storage&            paths
+                      , detail::existence_marks&            existence
+                      , boost::unique_lock< boost::mutex >& /* lock */ ) const {
+        if ( finished_jobs.empty() ) {
+            pending_jobs.push_back( job() );
+        } else {
+            pending_jobs.splice( pending_jobs.end(), finished_jobs, finished_jobs.begin() );
+        }
+        const job_it submitted_job = --pending_jobs.end();
+        submitted_job->paths                = &paths;
+        submitted_job->existence            = &existence;
+        submitted_job->next_path            = 0;
+        submitted_job->unchecked_quantity   = paths.size();
+        work_appeared.notify_all();
+        return submitted_job;
+    }
+
+    /// Waiting thread checks paths of its job too, so job is finished even without free workers.
+    void wait_for( job_it submitted_job, boost::unique_lock< boost::mutex >& lock ) const {
+        while ( submitted_job->next_path < submitted_job->paths->size() ) {
+            check_next_path( *submitted_job, lock );
+        }
+        while ( 0 != submitted_job->unchecked_quantity ) {
+            job_finished.wait( lock );
+        }
+        finished_jobs.splice( finished_jobs.end(), pending_jobs, submitted_job );
+    }
+
+    void work() const {
+        boost::unique_lock< boost::mutex > lock( guard );
+        for ( ;; ) {
+            job* current_job = job_with_unchecked_paths();
+            while ( !stopping && 0 == current_job ) {
+                work_appeared.wait( lock );
+                current_job = job_with_unchecked_paths();
+            }
+            if ( stopping ) {
+                return;
+            } else {}
+            check_next_path( *current_job, lock );
+        }
+    }
+
+    job* job_with_unchecked_paths() const {
+        for ( job_it it = pending_jobs.begin(); pending_jobs.end() != it; ++it ) {
+            if ( it->next_path < it->paths->size() ) {
+                return &*it;
+            } else {}
+        }
+        return 0;
+    }
+
+    /// Mutex is unlocked while path is checked.
+    void check_next_path( job& current_job, boost::unique_lock< boost::mutex >& lock ) const {
+        const size_t i = current_job.next_path++;
+        lock.unlock();
+        const bool path_exists = exists( ( *current_job.paths )[i] );
+        lock.lock();
+        ( *current_job.existence )[i] = path_exists;
+        if ( 0 == --current_job.unchecked_quantity ) {
+            job_finished.notify_all();
+        } else {}
+    }
+};
+
+} // namespace clpp
+
+#endif // CLPP_CONCURRENT_PATH_CHECKS_HPP
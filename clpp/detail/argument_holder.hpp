@@ -19,11 +19,22 @@
 #ifndef CLPP_DETAIL_ARGUMENT_HOLDER_HPP
 #define CLPP_DETAIL_ARGUMENT_HOLDER_HPP
 
-#include <boost/shared_ptr.hpp>
+#include "argument_caster.hpp"
+#include "holders_storage.hpp"
+#include "types.hpp"
+
 #include <boost/function.hpp>
 #include <boost/bind.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/optional.hpp>
 
 #include <string>
+#include <typeinfo>
+
+#if __cplusplus >= 201703L
+#include <optional>
+#define CLPP_STD_OPTIONAL
+#endif
 
 /// \namespace clpp
 /// \brief Main namespace of library.
@@ -33,16 +44,125 @@ namespace clpp {
 /// \brief Details of realization.
 namespace detail {
 
+/// \struct argument_holder_base
+/// \brief Type-erased argument's info holder.
+///
+/// Concrete holder is chosen at registration (by type of user's function argument),
+/// so during parsing value is converted and user's function is called directly,
+/// without checking of argument's type.
+///
+/// Holders of all parameters of parser are stored in 'holders_storage', every holder in its own size.
+struct argument_holder_base {
+    virtual ~argument_holder_base() {}
+
+    /// False for parameter registered without value.
+    virtual bool takes_value() const = 0;
+    virtual void call_without_value() const = 0;
+    virtual void call_with_inputed_value( const str_view&       inputed_value
+                                          , const std::string&  parameter_name ) const = 0;
+    virtual bool inputed_value_is_convertible( const str_view& inputed_value ) const = 0;
+    virtual std::string conversion_error_report( const std::string& parameter_name ) const = 0;
+    virtual void call_with_default_value() const = 0;
+    virtual void store_default_value( const any& value, const std::string& parameter_name ) = 0;
+    virtual bool argument_is_string() const = 0;
+    virtual const std::type_info& argument_type() const = 0;
+};
+
+/// \struct no_argument_holder
+/// \brief Holder of function without argument (corresponding to parameter without value).
+struct no_argument_holder : argument_holder_base {
+    typedef boost::function< void () > user_function_without_arg;
+public:
+    explicit no_argument_holder( void (*fn)() ) :
+            func_without_arg( fn ) {}
+
+	template< typename Object >
+	explicit no_argument_holder( Object* obj, void ( Object::*fn )() ) :
+            func_without_arg( boost::bind( fn, obj ) ) {}
+
+	template< typename Object >
+	explicit no_argument_holder( Object* obj, void ( Object::*fn )() const ) :
+            func_without_arg( boost::bind( fn, obj ) ) {}
+public:
+    user_function_without_arg func_without_arg;
+public:
+    bool takes_value() const { return false; }
+
+    void call_without_value() const {
+        func_without_arg();
+    }
+public:
+    /// Parameter without value has no argument, so these functions are not used.
+    void call_with_inputed_value( const str_view& /* inputed_value */, const std::string& /* parameter_name */ ) const {}
+    bool inputed_value_is_convertible( const str_view& /* inputed_value */ ) const { return false; }
+    std::string conversion_error_report( const std::string& /* parameter_name */ ) const { return std::string(); }
+    void call_with_default_value() const {}
+    bool argument_is_string() const { return false; }
+    const std::type_info& argument_type() const { return typeid( void ); }
+
+    void store_default_value( const any& /* value */, const std::string& parameter_name ) {
+        argument_caster().notify_about_unsupported_type( parameter_name );
+    }
+};
+
+/// \struct typed_argument_holder
+/// \brief Argument's info holder, common for all ways of value's passing.
+///
+/// Holds default value of argument (if defined), so default value is found 
+/// by type of argument, regardless of where value is passed.
+template< typename ArgType >
+struct typed_argument_holder : argument_holder_base {
+    typed_argument_holder() : 
+            default_value() {}
+
+    ArgType default_value;
+public:
+    bool takes_value() const { return true; }
+
+    /// Parameter with value has argument, so this function is not used.
+    void call_without_value() const {}
+
+    /// String argument is always convertible, so value is not copied.
+    bool inputed_value_is_convertible( const str_view& inputed_value ) const {
+        return argument_is_string() || argument_caster().can_cast< ArgType >( inputed_value );
+    }
+
+    std::string conversion_error_report( const std::string& parameter_name ) const {
+        return argument_caster().cast_error_report< ArgType >( parameter_name );
+    }
+
+    void store_default_value( const any& value, const std::string& parameter_name ) {
+        argument_caster().store( value, default_value, parameter_name );
+    }
+
+    bool argument_is_string() const {
+        return boost::is_same< ArgType, std::string >::value;
+    }
+
+    const std::type_info& argument_type() const {
+        return typeid( ArgType );
+    }
+};
+
+typedef typed_argument_holder< std::string > string_argument_holder;
+
 /// \struct argument_holder
 /// \brief Argument's info holder.
 ///
 /// Hold ptr to function with arguments (corresponding to parameter with value),
 /// and default value for it (if defined).
+///
+/// Any type that can be read from stream (with 'operator>>') can be type of argument.
+///
+/// Holder without function is used for parameter registered without function 
+/// (its value is taken from parse result): value is converted, but nothing is called.
 template< typename ArgType >
-struct argument_holder {
+struct argument_holder : typed_argument_holder< ArgType > {
     typedef boost::function< void ( const ArgType& /* value */ ) >
             user_function_with_arg;
 public:
+    argument_holder() {}
+
 	explicit argument_holder( void (*fn)( const ArgType& ) ) :
             func_with_arg( fn ) {}
 
@@ -66,31 +186,82 @@ public:
 		    func_with_arg( boost::bind( fn, obj, _1 ) ) {}
 public:
     user_function_with_arg  func_with_arg;
-    ArgType 			    default_value;
+public:
+    void call_with_inputed_value( const str_view&       inputed_value
+                                  , const std::string&  parameter_name ) const {
+        const ArgType argument = argument_caster().cast< ArgType >( inputed_value, parameter_name );
+        if ( !func_with_arg.empty() ) {
+            func_with_arg( argument );
+        } else {}
+    }
+
+    void call_with_default_value() const {
+        if ( !func_with_arg.empty() ) {
+            func_with_arg( this->default_value );
+        } else {}
+    }
 };
 
-typedef boost::shared_ptr< argument_holder< bool > >                b_arg_p;
+/// Conversion into user's variable: 'optional' gets value only if it's correct 
+/// (variable itself is not changed by incorrect value, see 'convert_value()').
+template< typename ArgType >
+inline void cast_into( ArgType& variable, const str_view& inputed_value, const std::string& parameter_name ) {
+    argument_caster().cast_to( inputed_value, variable, parameter_name );
+}
 
-typedef boost::shared_ptr< argument_holder< char > >                c_arg_p;
-typedef boost::shared_ptr< argument_holder< signed char > >         sc_arg_p;
-typedef boost::shared_ptr< argument_holder< unsigned char > >       uc_arg_p;
-typedef boost::shared_ptr< argument_holder< const char* > >         cca_arg_p;
+template< typename ArgType >
+inline void cast_into( boost::optional< ArgType >&  variable
+                       , const str_view&            inputed_value
+                       , const std::string&         parameter_name ) {
+    if ( variable ) {
+        argument_caster().cast_to( inputed_value, *variable, parameter_name );
+    } else {
+        variable = argument_caster().cast< ArgType >( inputed_value, parameter_name );
+    }
+}
 
-typedef boost::shared_ptr< argument_holder< int > > 			    i_arg_p;
-typedef boost::shared_ptr< argument_holder< signed int > > 			si_arg_p;
-typedef boost::shared_ptr< argument_holder< unsigned int > > 		ui_arg_p;
-typedef boost::shared_ptr< argument_holder< short int > > 	        shi_arg_p;
-typedef boost::shared_ptr< argument_holder< long int > > 	        li_arg_p;
-typedef boost::shared_ptr< argument_holder< unsigned long int > > 	uli_arg_p;
-typedef boost::shared_ptr< argument_holder< unsigned short int > > 	ushi_arg_p;
-typedef boost::shared_ptr< argument_holder< signed long int > > 	sli_arg_p;
-typedef boost::shared_ptr< argument_holder< signed short int > > 	sshi_arg_p;
+#ifdef CLPP_STD_OPTIONAL
+template< typename ArgType >
+inline void cast_into( std::optional< ArgType >&    variable
+                       , const str_view&            inputed_value
+                       , const std::string&         parameter_name ) {
+    if ( variable ) {
+        argument_caster().cast_to( inputed_value, *variable, parameter_name );
+    } else {
+        variable = argument_caster().cast< ArgType >( inputed_value, parameter_name );
+    }
+}
+#endif
 
-typedef boost::shared_ptr< argument_holder< float > >               f_arg_p;
-typedef boost::shared_ptr< argument_holder< double > >              d_arg_p;
-typedef boost::shared_ptr< argument_holder< long double > >         ld_arg_p;
+/// \struct variable_holder
+/// \brief Argument's info holder, for parameter bound to user's variable.
+///
+/// Value is converted directly into variable (without any function), so for 
+/// string or list argument memory of variable is reused. Incorrect value doesn't change variable.
+/// 'Variable' is 'ArgType' or 'optional' with 'ArgType' (such 'optional' stays empty 
+/// if parameter is not inputed and has no default value).
+template
+<
+    typename ArgType
+    , typename Variable
+>
+struct variable_holder : typed_argument_holder< ArgType > {
+    explicit variable_holder( Variable* _variable ) :
+            variable( _variable ) {}
+private:
+    Variable* variable;
+public:
+    void call_with_inputed_value( const str_view&       inputed_value
+                                  , const std::string&  parameter_name ) const {
+        cast_into( *variable, inputed_value, parameter_name );
+    }
+
+    void call_with_default_value() const {
+        *variable = this->default_value;
+    }
+};
 
-typedef boost::shared_ptr< argument_holder< std::string > > 	    s_arg_p;
+typedef holders_storage< argument_holder_base > arg_holders_storage;
 
 } // namespace detail
 } // namespace clpp
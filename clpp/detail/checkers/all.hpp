@@ -19,13 +19,7 @@
 #ifndef CLPP_DETAIL_ALL_CHECKERS_HPP
 #define CLPP_DETAIL_ALL_CHECKERS_HPP
 
-#include "common_checker.hpp"
-#include "incorrect_parameters.hpp"
-#include "necessary_parameters.hpp"
-#include "parameters_existence.hpp"
-#include "parameters_repetition.hpp"
-#include "parameters_redundancy.hpp"
-#include "values_correction.hpp"
-#include "values_semantic.hpp"
+#include "validation_engine.hpp"
+#include "validators.hpp"
 
 #endif // CLPP_DETAIL_ALL_CHECKERS_HPP
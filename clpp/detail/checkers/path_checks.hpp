@@ -0,0 +1,308 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+#ifndef CLPP_DETAIL_PATH_CHECKS_HPP
+#define CLPP_DETAIL_PATH_CHECKS_HPP
+
+#include "../types.hpp"
+#include "../parameters_index.hpp"
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/foreach.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// \namespace clpp::detail
+/// \brief Details of realization.
+namespace detail {
+
+/// Function that checks existence of one path.
+typedef bool ( *path_existence_function )( const std::string& path );
+
+/// Path that cannot be checked (for example, without permission) doesn't exist.
+inline bool path_exists_in_filesystem( const std::string& path ) {
+    boost::system::error_code error;
+    return boost::filesystem::exists( path, error );
+}
+
+/// Existence marks, 'char' instead of 'bool' so different marks can be written from different threads.
+typedef std::vector< char > existence_marks;
+
+/// \struct paths_existence_checker
+/// \brief Checker of existence of many paths at once.
+///
+/// Base for your own checkers. Checker must be thread-safe: frozen parser 
+/// uses one checker in all threads.
+///
+/// Parser starts check of paths right after tokenizing and finishes it before reporting 
+/// of semantic problems, so checker that doesn't check paths in calling thread 
+/// can override 'start()' and 'finish()': paths are checked meanwhile other checks are done.
+struct paths_existence_checker {
+    virtual ~paths_existence_checker() {}
+
+    /// Existence of 'paths[i]' is 'existence[i]' (marks are already sized).
+    virtual void check( const str_storage& paths, existence_marks& existence ) const = 0;
+
+    /// Starts check: 'existence' is ready after 'finish()' with the same marks,
+    /// 'paths' and 'existence' are not touched by caller until then. By default paths are checked here.
+    virtual void start( const str_storage& paths, existence_marks& existence ) const {
+        check( paths, existence );
+    }
+
+    /// Waits for the end of check started with 'existence'. Must not throw exceptions.
+    virtual void finish( existence_marks& /* existence */ ) const {}
+};
+
+/// \struct sequential_paths_existence_checker
+/// \brief Checks paths one by one (used by default).
+struct sequential_paths_existence_checker : paths_existence_checker {
+    explicit sequential_paths_existence_checker( path_existence_function _exists = path_exists_in_filesystem ) :
+            exists( _exists ) {}
+    
+    const path_existence_function exists;
+public:
+    void check( const str_storage& paths, existence_marks& existence ) const {
+        for ( size_t i = 0; i < paths.size(); ++i ) {
+            existence[i] = exists( paths[i] );
+        }
+    }
+};
+
+/// \struct paths_check
+/// \brief Check of paths of one parsing, maybe not finished yet.
+///
+/// Lives in per-parse state, so its buffers are reused by the next parsing.
+struct paths_check {
+    paths_check() : 
+            started( false ) {}
+
+    /// Existence of all paths, ready after 'path_checks::finish()'.
+    existence_marks         existence;
+    /// Paths that are not memoized, with their numbers in all paths. 
+    str_storage             unknown_paths;
+    std::vector< size_t >   unknown_numbers;
+    existence_marks         unknown_existence;
+    /// Unknown paths are being checked by checker.
+    bool                    started;
+};
+
+/// \class path_checks
+/// \brief Checks of 'path' semantic.
+///
+/// All paths of one parsing are checked at once, by one call of checker (so checker can 
+/// check them concurrently). In frozen parser existing paths are memoized: such path 
+/// is checked only once, and memoized paths are found without memory allocation. 
+/// Check can be started and finished later (so paths are checked meanwhile other checks are done).
+/// Nonexistent paths are not memoized, so path that appears later is found (default paths
+/// are checked only once anyway, see 'parameters_tables'). Memo is bounded: when it's full,
+/// the oldest paths are forgotten, only as many as needed for new ones.
+///
+/// Memo is shared between threads without mutex: it's immutable, readers take current memo 
+/// atomically, and writer publishes updated copy (new paths are rare, so copying is rare too).
+class path_checks : boost::noncopyable {
+    /// \struct memo_storage
+    /// \brief Existing paths with their numbers in order of memoizing.
+    ///
+    /// Only the oldest paths are forgotten, so numbers of memoized paths 
+    /// are always 'first_number', 'first_number + 1', ..., 'next_number - 1'.
+    struct memo_storage {
+        memo_storage() : 
+                first_number( 0 )
+                , next_number( 0 ) {}
+
+        boost::unordered_map< std::string, size_t, name_hash >  numbers;
+        size_t                                                  first_number;
+        size_t                                                  next_number;
+    public:
+        size_t size() const { return next_number - first_number; }
+
+        bool contains( const str_view& path ) const {
+            return numbers.end() != numbers.find( path, name_hash(), name_equal() );
+        }
+
+        void add( const std::string& path ) {
+            if ( numbers.insert( std::make_pair( path, next_number ) ).second ) {
+                ++next_number;
+            } else {}
+        }
+    };
+    typedef boost::shared_ptr< const memo_storage > memo_ptr;
+public:
+    path_checks() :
+            checker( &default_checker )
+            , memoizing( false ) {}
+private:
+    sequential_paths_existence_checker  default_checker;
+    const paths_existence_checker*      checker;
+    bool                                memoizing;
+    mutable memo_ptr                    memo;
+
+    static size_t memo_capacity() { return 4096; }
+public:
+    void use( const paths_existence_checker& another_checker ) { checker = &another_checker; }
+
+    void memoize() { memoizing = true; }
+
+    /// Existence of 'paths[i]' is 'existence[i]'.
+    void check( const str_views& paths, existence_marks& existence ) const {
+        paths_check current;
+        start( paths, current );
+        finish( current );
+        existence.swap( current.existence );
+    }
+
+    /// Memoized paths are found here, others are given to checker. 'paths' can be changed
+    /// right after it (unknown paths are copied), but 'current' must live until 'finish()'.
+    void start( const str_views& paths, paths_check& current ) const {
+        abandon( current );
+        current.existence.assign( paths.size(), 0 );
+        current.unknown_paths.clear();
+        current.unknown_numbers.clear();
+        take_memoized( paths, current );
+        if ( current.unknown_paths.empty() ) {
+            return;
+        } else {}
+
+        current.unknown_existence.assign( current.unknown_paths.size(), 0 );
+        checker->start( current.unknown_paths, current.unknown_existence );
+        current.started = true;
+    }
+
+    /// Existence of 'paths[i]' (from 'start()') is 'current.existence[i]' after it.
+    void finish( paths_check& current ) const {
+        if ( !current.started ) {
+            return;
+        } else {}
+        abandon( current );
+        for ( size_t i = 0; i < current.unknown_numbers.size(); ++i ) {
+            current.existence[current.unknown_numbers[i]] = current.unknown_existence[i];
+        }
+        remember( current.unknown_paths, current.unknown_existence );
+    }
+
+    /// Waits for started check without using its result (when parsing is stopped by exception).
+    void abandon( paths_check& current ) const {
+        if ( current.started ) {
+            current.started = false;
+            checker->finish( current.unknown_existence );
+        } else {}
+    }
+private:
+    void take_memoized( const str_views& paths, paths_check& current ) const {
+        const memo_ptr current_memo = memoizing ? boost::atomic_load( &memo ) : memo_ptr();
+        for ( size_t i = 0; i < paths.size(); ++i ) {
+            if ( current_memo && current_memo->contains( paths[i] ) ) {
+                current.existence[i] = true;
+            } else {
+                current.unknown_paths.push_back( paths[i].to_string() );
+                current.unknown_numbers.push_back( i );
+            }
+        }
+    }
+
+    /// If another thread published its memo meanwhile, its paths are kept too.
+    void remember( const str_storage& checked_paths, const existence_marks& checked_existence ) const {
+        if ( !memoizing ) {
+            return;
+        } else {}
+
+        memo_ptr current_memo = boost::atomic_load( &memo );
+        for ( ;; ) {
+            const memo_ptr updated_memo = updated( current_memo, checked_paths, checked_existence );
+            if ( updated_memo == current_memo 
+                 || boost::atomic_compare_exchange( &memo, &current_memo, updated_memo ) ) {
+                return;
+            } else {}
+        }
+    }
+
+    /// The same memo, if there are no new existing paths. Otherwise a copy without 
+    /// the oldest paths (if memo would be overfull) and with new ones.
+    static memo_ptr updated( const memo_ptr&            current_memo
+                             , const str_storage&       checked_paths
+                             , const existence_marks&   checked_existence ) {
+        str_storage new_paths;
+        for ( size_t i = 0; i < checked_paths.size(); ++i ) {
+            if ( 0 != checked_existence[i] && ( !current_memo || !current_memo->contains( checked_paths[i] ) ) ) {
+                new_paths.push_back( checked_paths[i] );
+            } else {}
+        }
+        if ( new_paths.empty() ) {
+            return current_memo;
+        } else {}
+
+        const size_t new_quantity = std::min( new_paths.size(), memo_capacity() );
+        boost::shared_ptr< memo_storage > updated_memo = boost::make_shared< memo_storage >();
+        if ( current_memo ) {
+            const size_t kept_quantity = std::min( current_memo->size(), memo_capacity() - new_quantity );
+            copy_newest( *current_memo, kept_quantity, *updated_memo );
+        } else {}
+        for ( size_t i = new_paths.size() - new_quantity; i < new_paths.size(); ++i ) {
+            updated_memo->add( new_paths[i] );
+        }
+        return updated_memo;
+    }
+
+    static void copy_newest( const memo_storage& memo, size_t quantity, memo_storage& copy ) {
+        copy.first_number = memo.next_number - quantity;
+        copy.next_number = memo.next_number;
+        copy.numbers.reserve( quantity );
+        typedef std::pair< const std::string, size_t > memoized_path;
+        BOOST_FOREACH ( const memoized_path& path, memo.numbers ) {
+            if ( path.second >= copy.first_number ) {
+                copy.numbers.insert( path );
+            } else {}
+        }
+    }
+};
+
+/// \class paths_check_guard
+/// \brief Waits for started check of paths, if it isn't finished (parsing is stopped by exception).
+class paths_check_guard : boost::noncopyable {
+public:
+    paths_check_guard( const path_checks& _path_checker, paths_check& _current ) :
+            path_checker( _path_checker )
+            , current( _current ) {}
+
+    ~paths_check_guard() {
+        path_checker.abandon( current );
+    }
+private:
+    const path_checks&  path_checker;
+    paths_check&        current;
+};
+
+} // namespace detail
+
+typedef detail::path_existence_function             path_existence_function;
+typedef detail::paths_existence_checker             paths_existence_checker;
+typedef detail::sequential_paths_existence_checker  sequential_paths_existence_checker;
+
+} // namespace clpp
+
+#endif // CLPP_DETAIL_PATH_CHECKS_HPP
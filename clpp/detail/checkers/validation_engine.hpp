@@ -0,0 +1,488 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+#ifndef CLPP_DETAIL_VALIDATION_ENGINE_HPP
+#define CLPP_DETAIL_VALIDATION_ENGINE_HPP
+
+#include "validators.hpp"
+#include "path_checks.hpp"
+#include "../diagnostics.hpp"
+#include "../instrumentation.hpp"
+#include "../parameter.hpp"
+#include "../parameters_index.hpp"
+#include "../parameters_tables.hpp"
+#include "../tokenizer.hpp"
+#include "../unnamed_parameters_handler.hpp"
+
+#include <boost/foreach.hpp>
+
+#include <algorithm>
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// \namespace clpp::detail
+/// \brief Details of realization.
+namespace detail {
+
+typedef std::vector< size_t, arena_allocator< size_t > > positions;
+
+/// \struct validation_state
+/// \brief Per-parse state of validation engine.
+///
+/// Lives in parse context (not in parser), so it keeps its buffers between parsings,
+/// and every concurrent parsing has its own state.
+struct validation_state {
+    explicit validation_state( parse_arena* arena = 0 ) :
+            unbound_unnamed_positions( positions::allocator_type( arena ) )
+            , separator_repetition_positions( positions::allocator_type( arena ) )
+            , incorrect_value_positions( positions::allocator_type( arena ) )
+            , incorrect_positions( positions::allocator_type( arena ) )
+            , semantic_positions( positions::allocator_type( arena ) )
+            , repeated_slots( positions::allocator_type( arena ) )
+            , inputed_slots( slots_marks::allocator_type( arena ) )
+            , paths( str_views::allocator_type( arena ) )
+            , next_path( 0 ) {}
+
+    positions                   unbound_unnamed_positions;
+    positions                   separator_repetition_positions;
+    positions                   incorrect_value_positions;
+    positions                   incorrect_positions;
+    positions                   semantic_positions;
+    /// Slots of registered parameters that were inputed more than once, in order of repetition.
+    positions                   repeated_slots;
+    /// Marks of registered parameters that were inputed (even with incorrect value). 
+    /// The only per-parse set of parameters: repetition, necessity and default values use it.
+    slots_marks                 inputed_slots;
+    /// Values with 'path' semantic (inputed, then default ones), checked at once.
+    str_views                   paths;
+    paths_check                 paths_existence;
+    size_t                      next_path;
+public:
+    void release_memory() {
+        release_memory_of( unbound_unnamed_positions );
+        release_memory_of( separator_repetition_positions );
+        release_memory_of( incorrect_value_positions );
+        release_memory_of( incorrect_positions );
+        release_memory_of( semantic_positions );
+        release_memory_of( repeated_slots );
+        release_memory_of( inputed_slots );
+        release_memory_of( paths );
+    }
+};
+
+/// \class validation_engine
+/// \brief Checker of inputed parameters.
+///
+/// Checks all rules (existence, redundancy, repetition, incorrect parameters,
+/// necessary parameters, values and values semantic) in one traversal of inputed tokens,
+/// binding unnamed parameters on the way. Problems are only noted during traversal,
+/// and reported after it in the same order as separate checkers did it:
+/// base checks first, then unnamed parameters, then all others.
+///
+/// By default first problem is reported by exception. If diagnostics is given, 
+/// all problems are collected in it (one problem per parameter), and types of inputed values 
+/// are checked too (usually it's done during call of user's functions).
+///
+/// If values are read lazily (parsing into result), semantic of values is not checked here:
+/// it's checked at first reading of value.
+///
+/// Engine is cheap and constructed for every parsing: all its per-parse state
+/// is in 'validation_state', so reused state doesn't allocate memory
+/// (until inputed parameters quantity grows).
+class validation_engine {
+public:
+    validation_engine( const parameters&                    _registered_parameters
+                       , const parameters_tables&           _tables
+                       , const unnamed_parameters_handler&  _unnamed_handler
+                       , const path_checks&                 _path_checker
+                       , validation_state&                  _state
+                       , diagnostics*                       _found_problems = 0
+                       , bool                               _values_are_read_lazily = false ) :
+            registered_parameters( _registered_parameters )
+            , tables( _tables )
+            , unnamed_handler( _unnamed_handler )
+            , path_checker( _path_checker )
+            , state( _state )
+            , found_problems( _found_problems )
+            , values_are_read_lazily( _values_are_read_lazily ) {}
+private:
+    const parameters&                   registered_parameters;
+    const parameters_tables&            tables;
+    const unnamed_parameters_handler&   unnamed_handler;
+    const path_checks&                  path_checker;
+    validation_state&                   state;
+    diagnostics*                        found_problems;
+    const bool                          values_are_read_lazily;
+public:
+    template< typename Instrumentation >
+    void check( tokens& inputed_tokens, Instrumentation& instruments ) {
+        instruments.check_started( inputed_parameters_traversal );
+        prepare_for();
+        for ( size_t position = 0; position < inputed_tokens.size(); ++position ) {
+            note_problems_of( position, inputed_tokens[position] );
+        }
+        start_check_of_paths( inputed_tokens );
+        instruments.check_finished( inputed_parameters_traversal, inputed_tokens.size() );
+
+        const paths_check_guard started_check( path_checker, state.paths_existence );
+        report_problems_of( inputed_tokens, instruments );
+    }
+private:
+    void prepare_for() {
+        state.unbound_unnamed_positions.clear();
+        state.separator_repetition_positions.clear();
+        state.incorrect_value_positions.clear();
+        state.incorrect_positions.clear();
+        state.semantic_positions.clear();
+        state.repeated_slots.clear();
+        state.inputed_slots.assign( registered_parameters.size(), false );
+    }
+private:
+    void note_problems_of( size_t position, token& inputed_token ) {
+        if ( inputed_token.separator_repeated ) {
+            note_inputing_of( inputed_token );
+            state.separator_repetition_positions.push_back( position );
+            return;
+        } else {}
+
+        if ( unnamed_handler.this_is_unnamed_parameter( inputed_token ) ) {
+            if ( !unnamed_handler.bind( position, inputed_token ) ) {
+                state.unbound_unnamed_positions.push_back( position );
+                return;
+            } else {}
+        } else {}
+        
+        if ( !inputed_token.is_registered() ) {
+            state.incorrect_positions.push_back( position );
+            return;
+        } else {}
+
+        note_inputing_of( inputed_token );
+        if ( !value_is_correct( inputed_token ) ) {
+            state.incorrect_value_positions.push_back( position );
+        } else if ( inputed_token.has_value() && no_semantic != tables.semantic_of( inputed_token.slot ) ) {
+            state.semantic_positions.push_back( position );
+        } else {}
+    }
+
+    /// Repetition is a repetition of registered parameter, regardless of its name 
+    /// (short or full), its value, or binding by order (for unnamed one).
+    void note_inputing_of( const token& inputed_token ) {
+        if ( !inputed_token.is_registered() ) {
+            return;
+        } else {}
+
+        const size_t slot = inputed_token.slot;
+        if ( !state.inputed_slots[slot] ) {
+            state.inputed_slots[slot] = true;
+        } else if ( state.repeated_slots.end() == std::find( state.repeated_slots.begin()
+                                                             , state.repeated_slots.end()
+                                                             , slot ) ) {
+            state.repeated_slots.push_back( slot );
+        } else {}
+    }
+
+    bool value_is_correct( const token& inputed_token ) const {
+        const bool registered_without_value = !tables.takes_value( inputed_token.slot );
+        return inputed_token.has_value() ? !registered_without_value && !inputed_token.value.empty()
+                                         : registered_without_value;
+    }
+private:
+    typedef void ( validation_engine::*checker )( const tokens& ) const;
+
+    template< typename Instrumentation >
+    void report_problems_of( const tokens& inputed_tokens, Instrumentation& instruments ) const {
+        const size_t inputed_quantity = inputed_tokens.size();
+        run( parameters_existence_check,    &validation_engine::check_parameters_existence,     inputed_tokens, inputed_quantity, instruments );
+        run( parameters_redundancy_check,   &validation_engine::check_parameters_redundancy,    inputed_tokens, inputed_quantity, instruments );
+        run( parameters_repetition_check,   &validation_engine::check_parameters_repetition,    inputed_tokens, inputed_quantity, instruments );
+        run( unnamed_parameters_check,      &validation_engine::check_unnamed_parameters,       inputed_tokens, inputed_quantity, instruments );
+        run( incorrect_parameters_check,    &validation_engine::check_incorrect_parameters,     inputed_tokens, inputed_quantity, instruments );
+        run( necessary_parameters_check,    &validation_engine::check_necessary_parameters,     inputed_tokens
+             , tables.necessary_slots.size(), instruments );
+        run( values_check,                  &validation_engine::check_values,                   inputed_tokens, inputed_quantity, instruments );
+        if ( values_are_read_lazily ) {
+            return;
+        } else {}
+        run( inputed_values_semantic_check, &validation_engine::check_semantic_of_inputed_values, inputed_tokens
+             , state.semantic_positions.size(), instruments );
+        run( default_values_semantic_check, &validation_engine::check_semantic_of_default_values, inputed_tokens
+             , tables.slots_with_default_value_semantic.size(), instruments );
+        if ( collecting_all_problems() ) {
+            run( values_types_check,        &validation_engine::check_types_of_inputed_values,  inputed_tokens, inputed_quantity, instruments );
+        } else {}
+    }
+
+    template< typename Instrumentation >
+    void run( parse_check               check
+              , checker                 check_function
+              , const tokens&           inputed_tokens
+              , size_t                  items
+              , Instrumentation&        instruments ) const {
+        instruments.check_started( check );
+        ( this->*check_function )( inputed_tokens );
+        instruments.check_finished( check, items );
+    }
+
+    bool collecting_all_problems() const { return 0 != found_problems; }
+
+    /// Without diagnostics first reported problem stops parsing.
+    template< typename Exception >
+    void report( problem_kind kind, const std::string& parameter_name, const std::string& what_happened ) const {
+        if ( !collecting_all_problems() ) {
+            throw Exception( what_happened );
+        } else {}
+        found_problems->add( kind, parameter_name, what_happened );
+    }
+private:
+    void check_parameters_existence( const tokens& inputed_tokens ) const {
+        if ( registered_parameters.empty() && !inputed_tokens.empty() ) {
+            const std::string what_happened = lib_prefix() + "You inputs some parameter(s), but no one registered!";
+            report< std::runtime_error >( no_registered_parameters, "", what_happened );
+        } else {} 
+    }
+
+    void check_parameters_redundancy( const tokens& inputed_tokens ) const {
+        const size_t inputed_parameters_quantity = inputed_tokens.size();
+        const size_t registered_parameters_quantity = registered_parameters.size();
+        if ( inputed_parameters_quantity > registered_parameters_quantity ) {
+            o_stream what_happened;
+            what_happened << lib_prefix() 
+                          << "You inputs " << inputed_parameters_quantity << " parameters, "
+                          << "but only " << registered_parameters_quantity << " registered!";
+            report< std::runtime_error >( too_many_parameters, "", what_happened.str() );
+        } else {} 
+    }
+
+    void check_parameters_repetition( const tokens& /* inputed_tokens */ ) const {
+        if ( state.repeated_slots.empty() ) {
+            return;
+        } else {}
+
+        str_storage repeated_names;
+        BOOST_FOREACH ( size_t slot, state.repeated_slots ) {
+            repeated_names.push_back( registered_parameters[slot].short_name );
+        }
+        report_about_parameters( parameters_repetition
+                                 , repeated_names
+                                 , " is inputed more than once!"
+                                 , " are inputed more than once!" );
+    }
+
+    void check_unnamed_parameters( const tokens& inputed_tokens ) const {
+        BOOST_FOREACH ( size_t position, state.unbound_unnamed_positions ) {
+            const str_view& inputed_parameter = inputed_tokens[position].inputed_parameter;
+            report< std::runtime_error >( unnamed_parameter_without_order
+                                          , inputed_parameter.to_string()
+                                          , unnamed_handler.missing_of_parameter_with_serial_number_report( 
+                                                    inputed_parameter, position + 1 ) );
+        }
+    }
+private:
+    void check_incorrect_parameters( const tokens& inputed_tokens ) const {
+        BOOST_FOREACH ( size_t position, state.separator_repetition_positions ) {
+            notify_about_name_value_separator_repetition_in( inputed_tokens[position].inputed_parameter );
+        }
+
+        if ( !state.incorrect_positions.empty() ) {
+            str_storage names;
+            BOOST_FOREACH ( size_t position, state.incorrect_positions ) {
+                names.push_back( inputed_tokens[position].name.to_string() );
+            }
+            report_about_parameters( incorrect_parameter
+                                     , names
+                                     , " is incorrect (no such parameter)!"
+                                     , " are incorrect (no such parameters)!" );
+        } else {}
+    }
+
+    void notify_about_name_value_separator_repetition_in( const str_view& inputed_parameter ) const {
+        const std::string what_happened = lib_prefix() 
+                                          + "Name-value separator repetition detected in parameter '" 
+                                          + inputed_parameter.to_string() + "'!";
+		report< std::runtime_error >( name_value_separator_repetition, inputed_parameter.to_string(), what_happened );
+    }
+
+    /// Without diagnostics all names are in one report, otherwise every name is reported separately.
+    void report_about_parameters( problem_kind          kind
+                                  , const str_storage&  names
+                                  , const std::string&  end_for_one
+                                  , const std::string&  end_for_many ) const {
+        if ( collecting_all_problems() ) {
+            BOOST_FOREACH ( const std::string& name, names ) {
+                report< std::runtime_error >( kind, name, lib_prefix() + "Parameter '" + name + "'" + end_for_one );
+            }
+            return;
+        } else {}
+
+        std::string what_happened = lib_prefix() + "Parameter ";
+        
+        BOOST_FOREACH ( const std::string& name, names ) {
+        	what_happened += "'" + name + "', ";
+        }
+        boost::erase_last( what_happened, ", " );
+
+        if ( 1 == names.size() ) {
+            what_happened += end_for_one;
+        } else {
+            boost::replace_first( what_happened, "Parameter", "Parameters" );
+            what_happened += end_for_many;
+        }
+
+        report< std::runtime_error >( kind, "", what_happened );
+    }
+private:
+    void check_necessary_parameters( const tokens& /* inputed_tokens */ ) const {
+        str_storage names_that_should_be;
+        BOOST_FOREACH ( size_t slot, tables.necessary_slots ) {
+            if ( !state.inputed_slots[slot] ) {
+                names_that_should_be.push_back( registered_parameters[slot].short_name );
+            } else {}
+        }
+        if ( !names_that_should_be.empty() ) {
+            report_about_parameters( missing_necessary_parameter
+                                     , names_that_should_be
+                                     , " is defined as necessary, but it missed!"
+                                     , " are defined as necessary, but they missed!" );
+        } else {}
+    }
+private:
+    void check_values( const tokens& inputed_tokens ) const {
+        BOOST_FOREACH ( size_t position, state.incorrect_value_positions ) {
+            const token& inputed_token = inputed_tokens[position];
+            if ( inputed_token.has_value() && !tables.takes_value( inputed_token.slot ) ) {
+                notify_about_parameter_with_unexpected_value( inputed_token.name, inputed_token.value );
+            } else {
+                notify_about_parameter_with_missing_value( inputed_token.name );
+            }
+        }
+    }
+
+    void notify_about_parameter_with_unexpected_value( const str_view& name
+                                                       , const str_view& value ) const {
+        const std::string what_happened = lib_prefix() 
+                                          + "Parameter '" + name.to_string() + "' inputed with value '" 
+                                          + value.to_string() + "', but registered without value!";
+		report< std::logic_error >( unexpected_value, name.to_string(), what_happened );
+    }
+    
+    void notify_about_parameter_with_missing_value( const str_view& name ) const {
+        const std::string what_happened = lib_prefix() + "Parameter '" + name.to_string() 
+			   		                      + "' registered with value, but value is missing!";
+		report< std::logic_error >( missing_value, name.to_string(), what_happened );
+    }
+private:
+    /// Check of paths was started after traversal, so here its result is only taken. 
+    void check_semantic_of_inputed_values( const tokens& inputed_tokens ) const {
+        path_checker.finish( state.paths_existence );
+        state.next_path = 0;
+        BOOST_FOREACH ( size_t position, state.semantic_positions ) {
+            const token& inputed_token = inputed_tokens[position];
+            check_semantic( inputed_token.slot, inputed_token.value );
+        }
+    }
+
+    void check_semantic_of_default_values( const tokens& /* inputed_tokens */ ) const {
+        BOOST_FOREACH ( size_t slot, tables.slots_with_default_value_semantic ) {
+            if ( state.inputed_slots[slot] ) {
+                continue;
+            } else {}
+            const std::string& value = registered_parameters[slot].default_string_value();
+            if ( existence_of_default_path_is_known( slot ) ) {
+                report_semantic_problem_if( !tables.default_path_exists( slot ), slot, value );
+            } else {
+                check_semantic( slot, value );
+            }
+        }
+    }
+
+    /// Frozen parser has already checked its default paths.
+    bool existence_of_default_path_is_known( size_t slot ) const {
+        return path == tables.semantic_of( slot ) && tables.default_paths_are_checked();
+    }
+
+    /// Paths are known right after traversal, so they are checked meanwhile other checks are done
+    /// (if checker does it in another thread). In the same order as paths are taken by 'check_semantic()'.
+    void start_check_of_paths( const tokens& inputed_tokens ) const {
+        if ( values_are_read_lazily ) {
+            return;
+        } else {}
+
+        state.paths.clear();
+        BOOST_FOREACH ( size_t position, state.semantic_positions ) {
+            const token& inputed_token = inputed_tokens[position];
+            if ( path == tables.semantic_of( inputed_token.slot ) ) {
+                state.paths.push_back( inputed_token.value );
+            } else {}
+        }
+        BOOST_FOREACH ( size_t slot, tables.slots_with_default_value_semantic ) {
+            if ( !state.inputed_slots[slot] 
+                 && path == tables.semantic_of( slot ) 
+                 && !existence_of_default_path_is_known( slot ) ) {
+                state.paths.push_back( registered_parameters[slot].default_string_value() );
+            } else {}
+        }
+        path_checker.start( state.paths, state.paths_existence );
+    }
+
+    bool semantic_is_correct( value_semantic semantic, const str_view& value ) const {
+        return path == semantic ? 0 != state.paths_existence.existence[state.next_path++]
+                                : value_semantic_is_correct( semantic, value );
+    }
+
+    void check_semantic( size_t slot, const str_view& value ) const {
+        report_semantic_problem_if( !semantic_is_correct( tables.semantic_of( slot ), value ), slot, value );
+    }
+
+    /// Registered parameter is visited only for report.
+    void report_semantic_problem_if( bool value_is_incorrect, size_t slot, const str_view& value ) const {
+        if ( value_is_incorrect ) {
+            const std::string& name = registered_parameters[slot].short_name;
+            report< std::invalid_argument >( incorrect_value_semantic
+                                             , name
+                                             , semantic_error_report( tables.semantic_of( slot ), value, name ) );
+        } else {}
+    }
+private:
+    /// Values that passed previous checks only.
+    void check_types_of_inputed_values( const tokens& inputed_tokens ) const {
+        BOOST_FOREACH ( const token& inputed_token, inputed_tokens ) {
+            if ( !inputed_token.has_value() 
+                 || !inputed_token.is_registered() 
+                 || inputed_token.separator_repeated 
+                 || inputed_token.value.empty()
+                 || !tables.takes_value( inputed_token.slot ) ) {
+                continue;
+            } else {}
+            const parameter& registered_parameter = registered_parameters[inputed_token.slot];
+            if ( !registered_parameter.holder->inputed_value_is_convertible( inputed_token.value ) ) {
+                const std::string& name = registered_parameter.short_name;
+                report< std::invalid_argument >( incorrect_value_type
+                                                 , name
+                                                 , registered_parameter.holder->conversion_error_report( name ) );
+            } else {}
+        }
+    }
+};
+
+} // namespace detail
+} // namespace clpp
+
+#endif // CLPP_DETAIL_VALIDATION_ENGINE_HPP
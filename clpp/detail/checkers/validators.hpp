@@ -19,10 +19,12 @@
 #ifndef CLPP_DETAIL_VALIDATORS_HPP
 #define CLPP_DETAIL_VALIDATORS_HPP
 
-#include <boost/filesystem/operations.hpp>
-#include <boost/asio/ip/address_v4.hpp>
-#include <boost/asio/ip/address_v6.hpp>
-#include <boost/regex.hpp>
+#include "../misc.hpp"
+#include "../types.hpp"
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
 
 /// \namespace clpp
 /// \brief Main namespace of library.
@@ -34,76 +36,209 @@ namespace detail {
 
 inline std::string semantic_error_prefix() { return lib_prefix() + "Semantic error: "; }
 
-inline void check_ipv4_validity( const std::string& address, const std::string& parameter_name ) {
-    try {
-        boost::asio::ip::address_v4 a( boost::asio::ip::address_v4::from_string( address ) );
-    } catch ( const std::exception& /* exc */ ) {
-        const std::string what_happened = semantic_error_prefix() 
-                                          + "parameter '" + parameter_name + "'" 
-                                          + " has invalid IPv4 value '" + address + "'!";
-        throw std::invalid_argument( what_happened );
+/// IPv4 address in dotted-decimal form: exactly 4 decimal octets (0-255), without leading zeros.
+inline bool ipv4_address_is_valid( const char* p, const char* end ) {
+    unsigned int octet = 0;
+    size_t octets = 0;
+    bool inside_octet = false;
+    while ( p != end ) {
+        const char symbol = *p++;
+        if ( '0' <= symbol && symbol <= '9' ) {
+            if ( inside_octet && 0 == octet ) {
+                return false;
+            } else {}
+            octet = octet * 10 + ( symbol - '0' );
+            if ( octet > 255 ) {
+                return false;
+            } else {}
+            if ( !inside_octet ) {
+                if ( ++octets > 4 ) {
+                    return false;
+                } else {}
+                inside_octet = true;
+            } else {}
+        } else if ( '.' == symbol && inside_octet ) {
+            if ( 4 == octets ) {
+                return false;
+            } else {}
+            octet = 0;
+            inside_octet = false;
+        } else {
+            return false;
+        }
     }
+    return 4 == octets;
 }
 
-inline void check_ipv6_validity( const std::string& address, const std::string& parameter_name ) {
-    try {
-        boost::asio::ip::address_v6 a( boost::asio::ip::address_v6::from_string( address ) );
-    } catch ( const std::exception& /* exc */ ) {
-        const std::string what_happened = semantic_error_prefix()
-                                          + "parameter '" + parameter_name + "'" 
-                                          + " has invalid IPv6 value '" + address + "'!";
-        throw std::invalid_argument( what_happened );
-    }
+inline bool hex_digit( char symbol ) {
+    return ( '0' <= symbol && symbol <= '9' ) 
+           || ( 'a' <= symbol && symbol <= 'f' ) 
+           || ( 'A' <= symbol && symbol <= 'F' );
 }
 
-inline void check_ip_validity( const std::string& address, const std::string& parameter_name ) {
-    try {
-        check_ipv4_validity( address, parameter_name );
-    } catch ( const std::exception& /* exc */ ) {
-        try {
-            check_ipv6_validity( address, parameter_name );
-        } catch ( const std::exception& /* exc */ ) {
-            const std::string what_happened = semantic_error_prefix()
-                                              + "parameter '" + parameter_name + "'" 
-                                              + " has invalid value '" + address + "' (not IPv4, not IPv6)!";
-            throw std::invalid_argument( what_happened );
+/// IPv6 address in text form: up to 8 groups of 1-4 hex digits, optional single '::',
+/// optional IPv4 address instead of last two groups.
+inline bool ipv6_address_is_valid( const char* p, const char* end ) {
+    const size_t address_size = 16;
+    size_t filled_bytes = 0;
+    size_t digits_in_group = 0;
+    bool zeros_compressed = false;
+
+    if ( end == p ) {
+        return false;
+    } else {}
+    if ( ':' == *p ) {
+        ++p;
+        if ( end == p || ':' != *p ) {
+            return false;
+        } else {}
+    } else {}
+
+    const char* group_begin = p;
+    while ( p != end ) {
+        const char symbol = *p++;
+        if ( hex_digit( symbol ) ) {
+            if ( 4 == digits_in_group++ ) {
+                return false;
+            } else {}
+        } else if ( ':' == symbol ) {
+            group_begin = p;
+            if ( 0 == digits_in_group ) {
+                if ( zeros_compressed ) {
+                    return false;
+                } else {}
+                zeros_compressed = true;
+                continue;
+            } else if ( end == p || filled_bytes + 2 > address_size ) {
+                return false;
+            } else {}
+            filled_bytes += 2;
+            digits_in_group = 0;
+        } else if ( '.' == symbol 
+                    && filled_bytes + 4 <= address_size 
+                    && ipv4_address_is_valid( group_begin, end ) ) {
+            filled_bytes += 4;
+            digits_in_group = 0;
+            break;
+        } else {
+            return false;
         }
     }
-}
 
-inline void check_path_existence( const std::string& path, const std::string& parameter_name ) {
-	if ( !boost::filesystem::exists( path ) ) {
-        const std::string what_happened = semantic_error_prefix()
-                                          + "parameter '" + parameter_name + "'" 
-                                          + " has invalid path value '" + path + "' (no such path)!";
-        throw std::invalid_argument( what_happened );
+    if ( digits_in_group > 0 ) {
+        if ( filled_bytes + 2 > address_size ) {
+            return false;
+        } else {}
+        filled_bytes += 2;
+    } else {}
+    if ( zeros_compressed ) {
+        if ( address_size == filled_bytes ) {
+            return false;
+        } else {}
+        filled_bytes = address_size;
     } else {}
+    return address_size == filled_bytes;
 }
 
-inline void check_email_validity( const std::string& email, const std::string& parameter_name ) {
-    const std::string all_acceptable_chars      = "[a-zA-Z0-9_.-]";
-    const std::string repeat_one_or_more_times  = "{1,}";
-    const std::string only_letters_and_numbers  = "[a-zA-Z0-9]";
-    const std::string only_letters              = "[a-zA-Z]";
-    const std::string repeat_as_domain          = "{2,6}";
-
-    const std::string regular_expression_for_email_validity = 
-            all_acceptable_chars + repeat_one_or_more_times
-            + only_letters_and_numbers + repeat_one_or_more_times
-            + "@"
-            + only_letters_and_numbers + repeat_one_or_more_times
-            + all_acceptable_chars + repeat_one_or_more_times
-            + "."
-            + only_letters + repeat_as_domain
-            ;
-
-    const boost::regex e( regular_expression_for_email_validity );
-    if ( !regex_match( email, e ) ) {
-        const std::string what_happened = semantic_error_prefix()
-                                          + "parameter '" + parameter_name + "'"
-                                          + " has invalid e-mail value '" + email + "'!";
-        throw std::invalid_argument( what_happened );
+/// Address is checked as C-string (up to first null symbol), like in previous versions.
+inline const char* end_of_address( const str_view& address ) {
+    return std::find( address.begin(), address.end(), '\0' );
+}
+
+inline bool ipv4_address_is_valid( const str_view& address ) {
+    return ipv4_address_is_valid( address.begin(), end_of_address( address ) );
+}
+
+/// Scope id (after '%') is ignored.
+inline bool ipv6_address_is_valid( const str_view& address ) {
+    const char* end = end_of_address( address );
+    return ipv6_address_is_valid( address.begin(), std::find( address.begin(), end, '%' ) );
+}
+
+inline bool ip_address_is_valid( const str_view& address ) {
+    return ipv4_address_is_valid( address ) || ipv6_address_is_valid( address );
+}
+
+/// Only ASCII letters, independently of locale (like in regular expression).
+inline bool email_letter( char symbol ) {
+    return ( 'a' <= symbol && symbol <= 'z' ) || ( 'A' <= symbol && symbol <= 'Z' );
+}
+
+inline bool email_letter_or_number( char symbol ) {
+    return email_letter( symbol ) || ( '0' <= symbol && symbol <= '9' );
+}
+
+inline bool email_acceptable_char( char symbol ) {
+    return email_letter_or_number( symbol ) || '_' == symbol || '.' == symbol || '-' == symbol;
+}
+
+/// Linear-time equivalent of regular expression (used in previous versions):
+/// [a-zA-Z0-9_.-]{1,}[a-zA-Z0-9]{1,}@[a-zA-Z0-9]{1,}[a-zA-Z0-9_.-]{1,}.[a-zA-Z]{2,6}
+/// Note that '.' before last part is any symbol (it was not escaped in regular expression).
+inline bool email_is_valid( const str_view& email ) {
+    const str_view::size_type at = email.find( '@' );
+    if ( str_view::npos == at || at < 2 || !email_letter_or_number( email[at - 1] ) ) {
+        return false;
     } else {}
+    for ( str_view::size_type i = 0; i < at; ++i ) {
+        if ( !email_acceptable_char( email[i] ) ) {
+            return false;
+        } else {}
+    }
+
+    // Domain is: prefix (at least 2 symbols, first is letter or number), any symbol, 2-6 letters.
+    const char* const domain = email.data() + at + 1;
+    const size_t domain_length = email.size() - at - 1;
+    if ( 0 == domain_length || !email_letter_or_number( domain[0] ) ) {
+        return false;
+    } else {}
+    size_t acceptable_prefix_length = 0;
+    while ( acceptable_prefix_length < domain_length && email_acceptable_char( domain[acceptable_prefix_length] ) ) {
+        ++acceptable_prefix_length;
+    }
+    size_t trailing_letters = 0;
+    while ( trailing_letters < domain_length && email_letter( domain[domain_length - 1 - trailing_letters] ) ) {
+        ++trailing_letters;
+    }
+
+    for ( size_t letters = 2; letters <= 6 && letters <= trailing_letters; ++letters ) {
+        if ( domain_length < letters + 3 ) {
+            break;
+        } else {}
+        const size_t prefix_length = domain_length - letters - 1;
+        if ( prefix_length <= acceptable_prefix_length ) {
+            return true;
+        } else {}
+    }
+    return false;
+}
+
+/// Check without exceptions. Paths are not checked here: all paths of parsing 
+/// are checked at once, by 'path_checks'.
+inline bool value_semantic_is_correct( value_semantic semantic, const str_view& value ) {
+    BOOST_ASSERT( path != semantic );
+    switch ( semantic ) {
+        case ipv4:  return ipv4_address_is_valid( value );
+        case ipv6:  return ipv6_address_is_valid( value );
+        case ip:    return ip_address_is_valid( value );
+        case email: return email_is_valid( value );
+        default:    return true;
+    }
+}
+
+inline std::string semantic_error_report( value_semantic        semantic
+                                          , const str_view&     value
+                                          , const std::string&  parameter_name ) {
+    std::string what_happened = semantic_error_prefix() + "parameter '" + parameter_name + "'";
+    switch ( semantic ) {
+        case path:  what_happened += " has invalid path value '" + value.to_string() + "' (no such path)!";    break;
+        case ipv4:  what_happened += " has invalid IPv4 value '" + value.to_string() + "'!";                   break;
+        case ipv6:  what_happened += " has invalid IPv6 value '" + value.to_string() + "'!";                   break;
+        case ip:    what_happened += " has invalid value '" + value.to_string() + "' (not IPv4, not IPv6)!";   break;
+        case email: what_happened += " has invalid e-mail value '" + value.to_string() + "'!";                 break;
+        default:    break;
+    }
+    return what_happened;
 }
 
 } // namespace detail
@@ -0,0 +1,102 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+#ifndef CLPP_DETAIL_DIAGNOSTICS_HPP
+#define CLPP_DETAIL_DIAGNOSTICS_HPP
+
+#include <string>
+#include <vector>
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// \enum problem_kind 
+/// \brief Kinds of problems found during parsing.
+enum problem_kind {
+    no_registered_parameters            /*!< Parameters inputed, but no one registered. */
+    , too_many_parameters               /*!< Inputed more parameters than registered. */
+    , parameters_repetition             /*!< Some parameter inputed more than once. */
+    , unnamed_parameter_without_order   /*!< No registered parameter with order number of unnamed parameter. */
+    , name_value_separator_repetition   /*!< Name-value separator inputed more than once. */
+    , incorrect_parameter               /*!< No such parameter. */
+    , missing_necessary_parameter       /*!< Necessary parameter missed. */
+    , unexpected_value                  /*!< Value inputed for parameter registered without value. */
+    , missing_value                     /*!< Value missed for parameter registered with value. */
+    , incorrect_value_semantic          /*!< Value failed semantic check. */
+    , incorrect_value_type              /*!< Value cannot be converted to type of function's argument. */
+    , incorrect_response_file           /*!< Response file cannot be read or includes itself. */
+};
+
+/// \namespace clpp::detail
+/// \brief Details of realization.
+namespace detail {
+
+/// \struct problem
+/// \brief One problem found during parsing.
+struct problem {
+    problem_kind    kind;
+    /// Name of parameter, empty if problem isn't related to one parameter.
+    std::string     parameter_name;
+    /// Report in the same form as reports of exceptions thrown by usual parsing.
+    std::string     what;
+};
+
+typedef std::vector< problem > problems;
+
+/// \struct diagnostics
+/// \brief All problems found during parsing.
+///
+/// Can be reused for many parsings: it keeps its buffer, so without problems
+/// (and after first parsings with problems) it doesn't allocate memory.
+struct diagnostics {
+    problems found;
+public:
+    bool empty() const { return found.empty(); }
+
+    void clear() { found.clear(); }
+
+    void add( problem_kind kind, const std::string& parameter_name, const std::string& what ) {
+        found.push_back( problem() );
+        problem& added = found.back();
+        added.kind              = kind;
+        added.parameter_name    = parameter_name;
+        added.what              = what;
+    }
+
+    /// All reports in one text.
+    std::string report( const std::string& separator = "\n" ) const {
+        std::string all_reports;
+        for ( problems::const_iterator it = found.begin(); found.end() != it; ++it ) {
+            if ( found.begin() != it ) {
+                all_reports += separator;
+            } else {}
+            all_reports += it->what;
+        }
+        return all_reports;
+    }
+};
+
+} // namespace detail
+
+typedef detail::problem     problem;
+typedef detail::diagnostics diagnostics;
+
+} // namespace clpp
+
+#endif // CLPP_DETAIL_DIAGNOSTICS_HPP
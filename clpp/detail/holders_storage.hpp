@@ -0,0 +1,127 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+
+#ifndef CLPP_DETAIL_HOLDERS_STORAGE_HPP
+#define CLPP_DETAIL_HOLDERS_STORAGE_HPP
+
+#include <boost/noncopyable.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// \namespace clpp::detail
+/// \brief Details of realization.
+namespace detail {
+
+/// \class holders_storage
+/// \brief Storage of polymorphic holders of one parser.
+///
+/// Holders are placed one after another in blocks of memory, every holder takes 
+/// exactly its own size, so holder of variable takes less memory than holder of function.
+/// Registration of parameter doesn't allocate memory for its holder (only new block,
+/// sometimes). Holders are never moved or copied, they are destroyed with storage.
+///
+/// 'Base' must have virtual destructor.
+template< typename Base >
+class holders_storage : boost::noncopyable {
+public:
+    holders_storage() : 
+            last_block( 0 )
+            , last_block_size( 0 )
+            , used_in_last_block( 0 ) {}
+
+    ~holders_storage() {
+        for ( size_t i = 0; i < holders.size(); ++i ) {
+            holders[i]->~Base();
+        }
+        for ( size_t i = 0; i < blocks.size(); ++i ) {
+            ::operator delete( blocks[i] );
+        }
+    }
+private:
+    std::vector< Base* >    holders;
+    std::vector< char* >    blocks;
+    char*                   last_block;
+    size_t                  last_block_size;
+    size_t                  used_in_last_block;
+
+    /// Blocks grow from small one (for usual parser with few parameters) up to the biggest one.
+    static size_t first_block_size() { return 256; }
+    static size_t biggest_block_size() { return 16 * 1024; }
+public:
+    template< typename Holder >
+    Base* store( const Holder& holder ) {
+        // Place in registry is taken before construction, so constructed holder is always destroyed.
+        holders.push_back( 0 );
+        try {
+            void* place = place_for( sizeof( Holder ), boost::alignment_of< Holder >::value );
+            holders.back() = new ( place ) Holder( holder );
+        } catch ( ... ) {
+            holders.pop_back();
+            throw;
+        }
+        return holders.back();
+    }
+private:
+    void* place_for( size_t size, size_t alignment ) {
+        size_t offset = aligned_offset( alignment );
+        if ( 0 == last_block || offset > last_block_size || size > last_block_size - offset ) {
+            add_block( size + alignment );
+            offset = aligned_offset( alignment );
+        } else {}
+        used_in_last_block = offset + size;
+        return last_block + offset;
+    }
+
+    /// Alignment of address, not of offset.
+    size_t aligned_offset( size_t alignment ) const {
+        const boost::uintptr_t address = reinterpret_cast< boost::uintptr_t >( last_block + used_in_last_block );
+        const boost::uintptr_t misalignment = address % alignment;
+        return 0 == misalignment ? used_in_last_block : used_in_last_block + alignment - misalignment;
+    }
+
+    void add_block( size_t minimal_size ) {
+        const size_t next_size = 0 == last_block_size ? first_block_size() 
+                                                      : std::min( 2 * last_block_size, biggest_block_size() );
+        const size_t size = std::max( next_size, minimal_size );
+        blocks.push_back( 0 );
+        try {
+            blocks.back() = static_cast< char* >( ::operator new( size ) );
+        } catch ( ... ) {
+            blocks.pop_back();
+            throw;
+        }
+        last_block = blocks.back();
+        last_block_size = size;
+        used_in_last_block = 0;
+    }
+};
+
+} // namespace detail
+} // namespace clpp
+
+#endif // CLPP_DETAIL_HOLDERS_STORAGE_HPP
@@ -0,0 +1,88 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+#ifndef CLPP_DETAIL_INSTRUMENTATION_HPP
+#define CLPP_DETAIL_INSTRUMENTATION_HPP
+
+#include <cstddef>
+#include <string>
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// \enum parse_phase 
+/// \brief Phases of parsing (for instrumentation).
+enum parse_phase {
+    obtaining_phase         /*!< Inputed parameters are obtained from 'argv'. */
+    , tokenizing_phase      /*!< Inputed parameters are split into names and values. */
+    , checking_phase        /*!< All checks, unnamed parameters are bound during it too. */
+    , calling_phase         /*!< User's functions are called. */
+};
+
+const size_t parse_phases_quantity = calling_phase + 1;
+
+/// \enum parse_check 
+/// \brief Parts of checking phase (for instrumentation).
+enum parse_check {
+    inputed_parameters_traversal        /*!< Problems are noted and unnamed parameters are bound. */
+    , parameters_existence_check
+    , parameters_redundancy_check
+    , parameters_repetition_check
+    , unnamed_parameters_check
+    , incorrect_parameters_check
+    , necessary_parameters_check
+    , values_check
+    , inputed_values_semantic_check
+    , default_values_semantic_check
+    , values_types_check                /*!< Only in parsing with diagnostics. */
+};
+
+const size_t parse_checks_quantity = values_types_check + 1;
+
+/// \namespace clpp::detail
+/// \brief Details of realization.
+namespace detail {
+
+struct parse_context;
+
+/// \struct no_instrumentation
+/// \brief Instrumentation policy that does nothing.
+///
+/// Used by default, all its hooks are empty and inlined, so instrumentation 
+/// costs nothing in usual parsing. Your own policy must have the same functions.
+/// 'Items' is a quantity of processed inputed parameters, checked values 
+/// or called functions. If check or function throws exception, its end isn't reported.
+struct no_instrumentation {
+    void phase_started( parse_phase /* phase */, const parse_context& /* context */ ) {}
+    void phase_finished( parse_phase /* phase */, const parse_context& /* context */, size_t /* items */ ) {}
+
+    void check_started( parse_check /* check */ ) {}
+    void check_finished( parse_check /* check */, size_t /* items */ ) {}
+
+    void function_started( const std::string& /* parameter_name */ ) {}
+    void function_finished( const std::string& /* parameter_name */ ) {}
+};
+
+} // namespace detail
+
+typedef detail::no_instrumentation no_instrumentation;
+
+} // namespace clpp
+
+#endif // CLPP_DETAIL_INSTRUMENTATION_HPP
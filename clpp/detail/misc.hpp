@@ -56,16 +56,6 @@ inline std::string to_str( const T& t ) {
     return as_string;
 }
 
-template
-<
-    typename STLContainer
-    , typename Element
->
-inline void delete_element( STLContainer& cont, const Element& element ) {
-    cont.erase( std::remove( cont.begin(), cont.end(), element )
-				, cont.end() );
-}
-
 } // namespace detail
 } // namespace clpp
 
@@ -21,13 +21,13 @@
 
 #include "argument_holder.hpp"
 #include "argument_caster.hpp"
-#include "checkers/all.hpp"
 #include "misc.hpp"
 
-#include <boost/make_shared.hpp>
 #include <boost/foreach.hpp>
+#include <boost/type.hpp>
 
 #include <set>
+#include <vector>
 
 /// \namespace clpp
 /// \brief Main namespace of library.
@@ -37,43 +37,97 @@ namespace clpp {
 /// \brief Details of realization.
 namespace detail {
 
+/// Order numbers of parameters registered in one parser.
+typedef std::set< size_t > orders_storage;
+
 /// \class parameter
 /// \brief Command line parameter.
 ///
 /// Presents one command line parameter with all options.
 class parameter {
-    typedef boost::function< void () >  user_func_without_arg;
-    typedef std::set< size_t >          orders_storage; 
 public:
     explicit parameter( const std::string&   short_name
                         , const std::string& full_name
-                        , void ( *fn )() ) :
-            func_without_arg( fn ) {
+                        , void ( *fn )()
+                        , arg_holders_storage& holders ) :
+            holder( holders.store( no_argument_holder( fn ) ) ) {
         init( short_name, full_name );
     } 
     
     template< typename ArgType >
     explicit parameter( const std::string&   short_name
                         , const std::string& full_name
-                        , void ( *fn )( const ArgType& ) ) :
-            for_arg( boost::make_shared< argument_holder<ArgType> >( fn ) ) {
+                        , void ( *fn )( const ArgType& )
+                        , arg_holders_storage& holders ) :
+            holder( holders.store( argument_holder<ArgType>( fn ) ) ) {
+        init( short_name, full_name );
+    }
+
+    template< typename ArgType >
+    explicit parameter( const std::string&   short_name
+                        , const std::string& full_name
+                        , void ( *fn )( ArgType )
+                        , arg_holders_storage& holders ) :
+            holder( holders.store( argument_holder<ArgType>( fn ) ) ) {
+        init( short_name, full_name );
+    }
+
+    /// Parameter without value and without function (its inputing is taken from parse result).
+    explicit parameter( const std::string&   short_name
+                        , const std::string& full_name
+                        , boost::type< void > /* type */
+                        , arg_holders_storage& holders ) :
+            holder( holders.store( no_argument_holder( &nothing_to_call ) ) ) {
+        init( short_name, full_name );
+    }
+
+    /// Parameter with value of type 'ArgType', without function (value is taken from parse result).
+    template< typename ArgType >
+    explicit parameter( const std::string&   short_name
+                        , const std::string& full_name
+                        , boost::type< ArgType > /* type */
+                        , arg_holders_storage& holders ) :
+            holder( holders.store( argument_holder< ArgType >() ) ) {
         init( short_name, full_name );
     }
 
+    /// Parameter bound to user's variable: value is converted directly into it.
     template< typename ArgType >
     explicit parameter( const std::string&   short_name
                         , const std::string& full_name
-                        , void ( *fn )( ArgType ) ) :
-            for_arg( boost::make_shared< argument_holder<ArgType> >( fn ) ) {
+                        , ArgType* variable
+                        , arg_holders_storage& holders ) :
+            holder( holders.store( variable_holder< ArgType, ArgType >( variable ) ) ) {
+        init( short_name, full_name );
+    }
+
+    template< typename ArgType >
+    explicit parameter( const std::string&           short_name
+                        , const std::string&         full_name
+                        , boost::optional< ArgType >* variable
+                        , arg_holders_storage&       holders ) :
+            holder( holders.store( variable_holder< ArgType, boost::optional< ArgType > >( variable ) ) ) {
         init( short_name, full_name );
     }
 
+#ifdef CLPP_STD_OPTIONAL
+    template< typename ArgType >
+    explicit parameter( const std::string&           short_name
+                        , const std::string&         full_name
+                        , std::optional< ArgType >*  variable
+                        , arg_holders_storage&       holders ) :
+            holder( holders.store( variable_holder< ArgType, std::optional< ArgType > >( variable ) ) ) {
+        init( short_name, full_name );
+    }
+#endif
+
     template< typename ObjectType >
     explicit parameter( const std::string&   short_name
                         , const std::string& full_name
                         , ObjectType* obj
-                        , void ( ObjectType::*fn )() ) :
-            func_without_arg( boost::bind( fn, obj ) ) {
+                        , void ( ObjectType::*fn )()
+                        , arg_holders_storage& holders ) :
+            holder( holders.store( no_argument_holder( obj, fn ) ) ) {
         init( short_name, full_name );
     }
     
@@ -81,8 +135,9 @@ public:
     explicit parameter( const std::string&   short_name
                         , const std::string& full_name
                         , ObjectType* obj
-                        , void ( ObjectType::*fn )() const ) :
-            func_without_arg( boost::bind( fn, obj ) ) {
+                        , void ( ObjectType::*fn )() const
+                        , arg_holders_storage& holders ) :
+            holder( holders.store( no_argument_holder( obj, fn ) ) ) {
         init( short_name, full_name );
     }
 
@@ -94,8 +149,9 @@ public:
     explicit parameter( const std::string&   short_name
                         , const std::string& full_name
                         , ObjectType* obj
-                        , void ( ObjectType::*fn )( const ArgType& ) ) :
-            for_arg( boost::make_shared< argument_holder<ArgType> >( obj, fn ) ) {
+                        , void ( ObjectType::*fn )( const ArgType& )
+                        , arg_holders_storage& holders ) :
+            holder( holders.store( argument_holder<ArgType>( obj, fn ) ) ) {
         init( short_name, full_name );
     }
     
@@ -107,8 +163,9 @@ public:
     explicit parameter( const std::string&   short_name
                         , const std::string& full_name
                         , ObjectType* obj
-                        , void ( ObjectType::*fn )( const ArgType& ) const ) :
-            for_arg( boost::make_shared< argument_holder<ArgType> >( obj, fn ) ) {
+                        , void ( ObjectType::*fn )( const ArgType& ) const
+                        , arg_holders_storage& holders ) :
+            holder( holders.store( argument_holder<ArgType>( obj, fn ) ) ) {
         init( short_name, full_name );
     }
 
@@ -120,8 +177,9 @@ public:
     explicit parameter( const std::string&   short_name
                         , const std::string& full_name
                         , ObjectType* obj
-                        , void ( ObjectType::*fn )( ArgType ) ) :
-            for_arg( boost::make_shared< argument_holder<ArgType> >( obj, fn ) ) {
+                        , void ( ObjectType::*fn )( ArgType )
+                        , arg_holders_storage& holders ) :
+            holder( holders.store( argument_holder<ArgType>( obj, fn ) ) ) {
         init( short_name, full_name );
     }
 
@@ -133,8 +191,9 @@ public:
     explicit parameter( const std::string&   short_name
                         , const std::string& full_name
                         , ObjectType* obj
-                        , void ( ObjectType::*fn )( ArgType ) const ) :
-            for_arg( boost::make_shared< argument_holder<ArgType> >( obj, fn ) ) {
+                        , void ( ObjectType::*fn )( ArgType ) const
+                        , arg_holders_storage& holders ) :
+            holder( holders.store( argument_holder<ArgType>( obj, fn ) ) ) {
         init( short_name, full_name );
     } 
 private:
@@ -143,29 +202,56 @@ private:
         full_name            = _full_name;
         is_necessary         = false;
         is_has_default_value = false;
+        is_value_taking      = holder->takes_value();
         semantic             = no_semantic;
         order_number         = 0;
+        orders               = 0;
+        parser_is_frozen     = 0;
     } 
+
+    static void nothing_to_call() {}
 public:
     std::string             short_name;
     std::string             full_name;
-	bool 		            is_necessary;
-	bool 			        is_has_default_value;
-	any		                for_arg;
-    user_func_without_arg	func_without_arg;
+    /// Holder of user's function (or variable), owned by parser's holders storage.
+    argument_holder_base*   holder;
 	value_semantic 	        semantic;
     int                     order_number;
-    static orders_storage   orders;
+    /// Order numbers registry of parser that owns this parameter.
+    orders_storage*         orders;
+    /// Frozenness of parser that owns this parameter: frozen parser's tables 
+    /// are already built, so settings of parameter cannot be changed.
+    const bool*             parser_is_frozen;
+	bool 		            is_necessary;
+	bool 			        is_has_default_value;
+    /// Holder is never replaced, so it's asked only once.
+    bool                    is_value_taking;
 public:
     bool has_default_value() const { return is_has_default_value; }
     bool it_is_necessary() const { return is_necessary; }
+    bool takes_value() const { return is_value_taking; }
+
+    /// Default value of parameter with string argument (only such values have semantic).
+    const std::string& default_string_value() const {
+        return static_cast< const string_argument_holder& >( *holder ).default_value;
+    }
 public:
 	parameter& check_semantic( const value_semantic& _semantic ) {
+        check_changeability();
         check_semantic_validity( _semantic );
 	    semantic = _semantic;
 	    return *this;
 	}
 private:
+    void check_changeability() const {
+        if ( 0 != parser_is_frozen && *parser_is_frozen ) {
+            const std::string what_happened = lib_prefix()
+                                              + "Parser is frozen, so settings of parameter '" + short_name 
+                                              + "' cannot be changed!";
+            throw std::logic_error( what_happened );
+        } else {}
+    }
+
     void check_semantic_validity( const value_semantic& _semantic ) const {
         if ( _semantic < no_semantic || _semantic > email ) {
             const std::string what_happened = lib_prefix()
@@ -175,6 +261,7 @@ private:
     }
 public:
 	parameter& necessary() {
+        check_changeability();
 		check_parameter_default_value_existence();
 		is_necessary = true;
 		return *this;
@@ -209,16 +296,20 @@ private:
 			throw std::logic_error( what_happened );
 		} else {}
     }
-private:
-    argument_caster caster;
 public:
 	parameter& default_value( const any& value ) {
+        check_changeability();
 	    check_parameter_necessity();
 		check_validity_of_string_default_value( value );
 		is_has_default_value = true;
-        caster.store_default_value( for_arg, value, short_name );
+        store_default_value( value );
 		return *this;
 	}
+private:
+    /// Parameter without value doesn't support default value (its holder reports about it).
+    void store_default_value( const any& value ) {
+        holder->store_default_value( value, short_name );
+    }
 private:
 template< typename ExpectedType >
     ExpectedType check_type_of_default_value( const any& value ) const {
@@ -242,6 +333,7 @@ public:
 	}
 public:
     parameter& order( int _order_number ) {
+        check_changeability();
         order_number = _order_number;
         check_order_validity();
         check_order_uniqueness(); 
@@ -260,9 +352,9 @@ private:
     }
 
     void check_order_uniqueness() {
-        const size_t current_orders_quantity = orders.size();
-        orders.insert( order_number );
-        const size_t new_orders_quantity = orders.size();
+        const size_t current_orders_quantity = orders->size();
+        orders->insert( order_number );
+        const size_t new_orders_quantity = orders->size();
         if ( current_orders_quantity == new_orders_quantity ) {
             const std::string what_happened = lib_prefix() + "Parameter's order number must be unique!";
             throw std::logic_error( what_happened );
@@ -272,20 +364,16 @@ public:
     bool operator==( const std::string& parameter_name ) const {
     	return parameter_name == short_name || parameter_name == full_name;
     }
-
-    bool operator==( int _order_number ) const {
-        return _order_number == order_number;
-    }
 };
 
-parameter::orders_storage parameter::orders;
-
 } // namespace detail
 
-typedef detail::parameter           parameter;
-typedef std::vector< parameter >    parameters;
-typedef parameters::iterator        parameter_it;
-typedef parameters::const_iterator  parameter_const_it;
+typedef detail::parameter               parameter;
+/// Parameters are stored by value, one after another: parameter's record is small 
+/// (its holder is in parser's holders storage), so it's cheap to move.
+typedef std::vector< parameter >        parameters;
+typedef parameters::iterator            parameter_it;
+typedef parameters::const_iterator      parameter_const_it;
 
 } // namespace clpp
 
@@ -0,0 +1,191 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+#ifndef CLPP_DETAIL_PARAMETERS_INDEX_HPP
+#define CLPP_DETAIL_PARAMETERS_INDEX_HPP
+
+#include "parameter.hpp"
+
+#include <boost/functional/hash.hpp>
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// \namespace clpp::detail
+/// \brief Details of realization.
+namespace detail {
+
+/// \struct name_hash
+/// \brief Hash of parameter's name.
+///
+/// Gives equal hashes for std::string and str_view, so index can be searched by view.
+struct name_hash {
+    size_t operator()( const std::string& name ) const {
+        return boost::hash_range( name.begin(), name.end() );
+    }
+
+    size_t operator()( const str_view& name ) const {
+        return boost::hash_range( name.begin(), name.end() );
+    }
+};
+
+/// \struct name_equal
+/// \brief Comparison of parameter's name view with registered name.
+struct name_equal {
+    bool operator()( const str_view& name, const std::string& registered_name ) const {
+        return name == registered_name;
+    }
+};
+
+/// \class parameters_index
+/// \brief Index of registered parameters.
+///
+/// Maps short and full names of registered parameters to their slots
+/// (positions in registered parameters storage). Filled at registration time,
+/// so name lookup during parsing takes O(1) instead of linear search.
+///
+/// Index is an open addressing table stored as parallel dense arrays: hashes of names, 
+/// slots, and positions of names (names themselves are stored one after another, in one string).
+/// So lookup of inputed name scans few neighbour cells of 'hashes', and compares names 
+/// only if hashes are equal, without visiting registered parameters at all.
+class parameters_index {
+    /// \struct name_position
+    /// \brief Position of name in names storage.
+    struct name_position {
+        name_position() : 
+                begin( 0 )
+                , size( 0 ) {}
+        name_position( size_t _begin, size_t _size ) :
+                begin( _begin )
+                , size( _size ) {}
+
+        size_t begin;
+        size_t size;
+    };
+    typedef std::vector< name_position > name_positions;
+public:
+    explicit parameters_index( const parameters& _registered_parameters ) :
+            registered_parameters( _registered_parameters )
+            , names_quantity( 0 ) {}
+private:
+    const parameters&       registered_parameters;
+    std::vector< size_t >   hashes;
+    /// Slot of name in cell, or 'no_slot' for free cell.
+    std::vector< size_t >   slots;
+    name_positions          positions;
+    std::string             names;
+    size_t                  names_quantity;
+public:
+    void add( const parameter& registered_parameter, size_t slot ) {
+        add_name( registered_parameter.short_name, slot );
+        add_name( registered_parameter.full_name, slot );
+    }
+
+    bool contains( const std::string& name ) const {
+        return no_slot != slot_of( name );
+    }
+
+    parameter_const_it find( const std::string& name ) const {
+        const size_t slot = slot_of( name );
+        return no_slot != slot ? registered_parameters.begin() + slot
+                               : registered_parameters.end();
+    }
+
+    size_t slot_of( const str_view& name ) const {
+        const size_t cell = cell_of( name, name_hash()( name ) );
+        return no_slot != cell ? slots[cell] : no_slot;
+    }
+private:
+    void add_name( const std::string& name, size_t slot ) {
+        if ( name.empty() ) {
+            return;
+        } else {}
+
+        const size_t hash = name_hash()( name );
+        const size_t cell = cell_of( name, hash );
+        if ( no_slot != cell ) {
+            slots[cell] = slot;
+            return;
+        } else {}
+
+        // Table is kept at most half full, so free cells are always near.
+        if ( 2 * ( names_quantity + 1 ) > slots.size() ) {
+            grow();
+        } else {}
+        put( hash, slot, name_position( names.size(), name.size() ) );
+        names += name;
+        ++names_quantity;
+    }
+
+    /// Cell with such name, or 'no_slot'.
+    size_t cell_of( const str_view& name, size_t hash ) const {
+        if ( slots.empty() ) {
+            return no_slot;
+        } else {}
+
+        const size_t mask = slots.size() - 1;
+        for ( size_t cell = hash & mask; ; cell = ( cell + 1 ) & mask ) {
+            if ( hash == hashes[cell] && no_slot != slots[cell] && name == name_in( cell ) ) {
+                return cell;
+            } else if ( no_slot == slots[cell] ) {
+                return no_slot;
+            } else {}
+        }
+    }
+
+    str_view name_in( size_t cell ) const {
+        return str_view( names.data() + positions[cell].begin, positions[cell].size );
+    }
+
+    void put( size_t hash, size_t slot, const name_position& position ) {
+        const size_t mask = slots.size() - 1;
+        size_t cell = hash & mask;
+        while ( no_slot != slots[cell] ) {
+            cell = ( cell + 1 ) & mask;
+        }
+        hashes[cell]    = hash;
+        slots[cell]     = slot;
+        positions[cell] = position;
+    }
+
+    /// Names are not rehashed: their hashes are already stored.
+    void grow() {
+        std::vector< size_t > old_hashes;
+        std::vector< size_t > old_slots;
+        name_positions old_positions;
+        old_hashes.swap( hashes );
+        old_slots.swap( slots );
+        old_positions.swap( positions );
+
+        const size_t cells_quantity = old_slots.empty() ? 16 : 2 * old_slots.size();
+        hashes.assign( cells_quantity, 0 );
+        slots.assign( cells_quantity, no_slot );
+        positions.assign( cells_quantity, name_position() );
+        for ( size_t cell = 0; cell < old_slots.size(); ++cell ) {
+            if ( no_slot != old_slots[cell] ) {
+                put( old_hashes[cell], old_slots[cell], old_positions[cell] );
+            } else {}
+        }
+    }
+};
+
+} // namespace detail
+} // namespace clpp
+
+#endif // CLPP_DETAIL_PARAMETERS_INDEX_HPP
@@ -0,0 +1,174 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+#ifndef CLPP_DETAIL_PARSE_ARENA_HPP
+#define CLPP_DETAIL_PARSE_ARENA_HPP
+
+#include <boost/noncopyable.hpp>
+#include <boost/cstdint.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <new>
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// \namespace clpp::detail
+/// \brief Details of realization.
+namespace detail {
+
+/// \class parse_arena
+/// \brief Monotonic arena for per-parse memory.
+///
+/// Memory is taken from caller-supplied buffer, deallocation does nothing,
+/// and whole buffer is released at once by 'reset()'. Without buffer (or if buffer
+/// is exhausted) memory is taken from heap. All heap allocations are counted.
+class parse_arena : boost::noncopyable {
+public:
+    parse_arena() :
+            buffer( 0 )
+            , buffer_size( 0 )
+            , used( 0 )
+            , heap_allocations_quantity( 0 ) {}
+
+    parse_arena( char* _buffer, size_t _buffer_size ) :
+            buffer( _buffer )
+            , buffer_size( _buffer_size )
+            , used( 0 )
+            , heap_allocations_quantity( 0 ) {}
+private:
+    char*   buffer;
+    size_t  buffer_size;
+    size_t  used;
+    size_t  heap_allocations_quantity;
+public:
+    void* allocate( size_t size ) {
+        const size_t offset = aligned_offset();
+        if ( offset <= buffer_size && size <= buffer_size - offset ) {
+            used = offset + size;
+            return buffer + offset;
+        } else {}
+
+        ++heap_allocations_quantity;
+        return ::operator new( size );
+    }
+
+    void deallocate( void* p ) {
+        if ( !in_buffer( static_cast< char* >( p ) ) ) {
+            ::operator delete( p );
+        } else {}
+    }
+
+    void reset() { used = 0; }
+
+    bool has_buffer() const { return 0 != buffer; }
+
+    size_t heap_allocations() const { return heap_allocations_quantity; }
+private:
+    static size_t alignment() { return 2 * sizeof( void* ); }
+
+    /// Alignment of address, not of offset (buffer itself can be unaligned).
+    size_t aligned_offset() const {
+        const boost::uintptr_t address = reinterpret_cast< boost::uintptr_t >( buffer + used );
+        const boost::uintptr_t misalignment = address & ( alignment() - 1 );
+        return 0 == misalignment ? used : used + alignment() - misalignment;
+    }
+
+    bool in_buffer( char* p ) const {
+        return has_buffer() 
+               && !std::less< char* >()( p, buffer ) 
+               && std::less< char* >()( p, buffer + buffer_size );
+    }
+};
+
+/// \class arena_allocator
+/// \brief Allocator of containers used during parsing.
+///
+/// Default-constructed allocator (without arena) uses heap directly, 
+/// so containers of the same types can be used outside of parsing.
+template< typename T >
+class arena_allocator {
+public:
+    typedef T                   value_type;
+    typedef T*                  pointer;
+    typedef const T*            const_pointer;
+    typedef T&                  reference;
+    typedef const T&            const_reference;
+    typedef std::size_t         size_type;
+    typedef std::ptrdiff_t      difference_type;
+
+    template< typename U >
+    struct rebind { typedef arena_allocator< U > other; };
+public:
+    arena_allocator() : arena( 0 ) {}
+
+    explicit arena_allocator( parse_arena* _arena ) : arena( _arena ) {}
+
+    template< typename U >
+    arena_allocator( const arena_allocator< U >& another ) : arena( another.arena ) {}
+public:
+    parse_arena* arena;
+public:
+    pointer allocate( size_type n, const void* /* hint */ = 0 ) {
+        if ( n > max_size() ) {
+            throw std::bad_alloc();
+        } else {}
+        const size_t size = n * sizeof( T );
+        return static_cast< pointer >( 0 != arena ? arena->allocate( size ) : ::operator new( size ) );
+    }
+
+    void deallocate( pointer p, size_type /* n */ ) {
+        if ( 0 != arena ) {
+            arena->deallocate( p );
+        } else {
+            ::operator delete( p );
+        }
+    }
+
+    size_type max_size() const { return std::numeric_limits< size_type >::max() / sizeof( T ); }
+
+    pointer address( reference value ) const { return &value; }
+    const_pointer address( const_reference value ) const { return &value; }
+
+    void construct( pointer p, const T& value ) { new ( p ) T( value ); }
+    void destroy( pointer p ) { p->~T(); }
+};
+
+template< typename T, typename U >
+inline bool operator==( const arena_allocator< T >& left, const arena_allocator< U >& right ) {
+    return left.arena == right.arena;
+}
+
+template< typename T, typename U >
+inline bool operator!=( const arena_allocator< T >& left, const arena_allocator< U >& right ) {
+    return left.arena != right.arena;
+}
+
+/// Frees container's memory (to its arena) and keeps its allocator.
+template< typename Container >
+inline void release_memory_of( Container& container ) {
+    Container( container.get_allocator() ).swap( container );
+}
+
+} // namespace detail
+} // namespace clpp
+
+#endif // CLPP_DETAIL_PARSE_ARENA_HPP
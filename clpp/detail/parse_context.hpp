@@ -0,0 +1,90 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+#ifndef CLPP_DETAIL_PARSE_CONTEXT_HPP
+#define CLPP_DETAIL_PARSE_CONTEXT_HPP
+
+#include "types.hpp"
+#include "parse_arena.hpp"
+#include "tokenizer.hpp"
+#include "checkers/validation_engine.hpp"
+#include "response_files.hpp"
+
+#include <boost/noncopyable.hpp>
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// \namespace clpp::detail
+/// \brief Details of realization.
+namespace detail {
+
+/// \struct parse_context
+/// \brief Per-parse state.
+///
+/// Holds all state that changes during parsing, so frozen parser itself stays unchanged
+/// and can be shared between threads, each thread with its own context.
+/// Context keeps its buffers between parsings, so reused context doesn't allocate memory.
+///
+/// Context can be created with caller-supplied buffer: in this case all per-parse memory
+/// is taken from this buffer (as from monotonic arena), and buffer is reset at the beginning
+/// of every parsing. If buffer is too small, the rest of memory is taken from heap.
+///
+/// Response files expanded during parsing stay mapped until the next parsing with this context.
+struct parse_context : boost::noncopyable {
+    parse_context() :
+            inputed_parameters( str_views::allocator_type( &arena ) )
+            , inputed_tokens( tokens::allocator_type( &arena ) )
+            , validation( &arena ) {}
+
+    parse_context( char* buffer, size_t buffer_size ) :
+            arena( buffer, buffer_size )
+            , inputed_parameters( str_views::allocator_type( &arena ) )
+            , inputed_tokens( tokens::allocator_type( &arena ) )
+            , validation( &arena ) {}
+
+    parse_arena             arena;
+    str_views               inputed_parameters;
+    tokens                  inputed_tokens;
+    validation_state        validation;
+    response_files_expander response_files;
+public:
+    /// Quantity of heap allocations made by parser for this context 
+    /// (memory for values of user's functions arguments is not included).
+    size_t heap_allocations() const { return arena.heap_allocations(); }
+
+    /// Without buffer only response files are released: buffers of previous parsing are reused.
+    void prepare_for_parsing() {
+        response_files.release();
+        if ( arena.has_buffer() ) {
+            release_memory_of( inputed_parameters );
+            release_memory_of( inputed_tokens );
+            validation.release_memory();
+            arena.reset();
+        } else {}
+    }
+};
+
+} // namespace detail
+
+typedef detail::parse_context parse_context;
+
+} // namespace clpp
+
+#endif // CLPP_DETAIL_PARSE_CONTEXT_HPP
@@ -0,0 +1,306 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+
+#ifndef CLPP_DETAIL_PARSE_RESULT_HPP
+#define CLPP_DETAIL_PARSE_RESULT_HPP
+
+#include "checkers/validators.hpp"
+#include "checkers/path_checks.hpp"
+#include "parameter.hpp"
+#include "parameters_index.hpp"
+#include "parameters_tables.hpp"
+#include "tokenizer.hpp"
+#include "argument_caster.hpp"
+#include "misc.hpp"
+
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/foreach.hpp>
+
+#include <algorithm>
+#include <typeinfo>
+#include <vector>
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// \namespace clpp::detail
+/// \brief Details of realization.
+namespace detail {
+
+/// \struct inputed_value
+/// \brief Inputed value of registered parameter, in values storage of parse result.
+///
+/// Converted value is created at first reading and published atomically 
+/// (copies of result can be read from several threads).
+struct inputed_value {
+    inputed_value() : 
+            slot( no_slot )
+            , begin( 0 )
+            , size( 0 ) {}
+
+    size_t                                  slot;
+    size_t                                  begin;
+    size_t                                  size;
+    mutable boost::shared_ptr< const any >  converted;
+public:
+    bool operator<( const inputed_value& another ) const { return slot < another.slot; }
+};
+
+/// \class parse_result_data
+/// \brief Inputed values of one parsing.
+///
+/// Inputed values are copied in one storage (so result doesn't depend on 'argv', 
+/// on response files and on parse context), and they are found by slot of registered parameter.
+/// Storage is sized by inputed parameters (not by registered ones), and it's reused 
+/// by the next parsing into the same result, if result is not shared with its copies.
+///
+/// Value is converted (and its semantic is checked) only at first reading, without locking:
+/// if several threads convert the same value at once, the first published one is kept. 
+/// Default values are taken from registered parameters, without copying.
+class parse_result_data : boost::noncopyable {
+    typedef std::vector< inputed_value >    inputed_values;
+    typedef inputed_values::const_iterator  inputed_value_const_it;
+public:
+    parse_result_data( const parameters&            _registered_parameters
+                       , const parameters_index&    _index
+                       , const parameters_tables&   _tables
+                       , const path_checks&         _path_checker ) :
+            registered_parameters( _registered_parameters )
+            , index( _index )
+            , tables( _tables )
+            , path_checker( _path_checker ) {}
+private:
+    const parameters&           registered_parameters;
+    const parameters_index&     index;
+    const parameters_tables&    tables;
+    const path_checks&          path_checker;
+    std::string                 values;
+    /// Sorted by slot.
+    inputed_values              values_of_inputed;
+public:
+    bool parsed_by( const parameters& another_registered_parameters ) const {
+        return &registered_parameters == &another_registered_parameters;
+    }
+
+    /// Tokens are already checked by validation engine, so every registered parameter is inputed once.
+    /// Previous values are replaced, memory of their storage is reused.
+    void collect( const tokens& inputed_tokens ) {
+        size_t values_size = 0;
+        BOOST_FOREACH ( const token& inputed_token, inputed_tokens ) {
+            values_size += inputed_token.value.size();
+        }
+        values.clear();
+        values.reserve( values_size );
+        values_of_inputed.clear();
+        values_of_inputed.reserve( inputed_tokens.size() );
+
+        BOOST_FOREACH ( const token& inputed_token, inputed_tokens ) {
+            inputed_value value;
+            value.slot  = inputed_token.slot;
+            value.begin = values.size();
+            value.size  = inputed_token.value.size();
+            values_of_inputed.push_back( value );
+            values.append( inputed_token.value.data(), inputed_token.value.size() );
+        }
+        std::sort( values_of_inputed.begin(), values_of_inputed.end() );
+    }
+public:
+    bool inputed( const std::string& parameter_name ) const {
+        return values_of_inputed.end() != find( slot_of( parameter_name ) );
+    }
+
+    /// Type must be the same as type of argument in registration.
+    template< typename ArgType >
+    const ArgType& value( const std::string& parameter_name ) const {
+        const size_t slot = slot_of( parameter_name );
+        const parameter& registered_parameter = registered_parameters[slot];
+        const inputed_value_const_it it = find( slot );
+        check_value_existence_of( registered_parameter, values_of_inputed.end() != it );
+        check_type_of_value< ArgType >( registered_parameter );
+
+        return values_of_inputed.end() != it ? converted_value< ArgType >( registered_parameter, *it )
+                                   : default_value< ArgType >( slot );
+    }
+private:
+    inputed_value_const_it find( size_t slot ) const {
+        inputed_value wanted;
+        wanted.slot = slot;
+        const inputed_value_const_it it = std::lower_bound( values_of_inputed.begin(), values_of_inputed.end(), wanted );
+        return values_of_inputed.end() != it && slot == it->slot ? it : values_of_inputed.end();
+    }
+
+    size_t slot_of( const std::string& parameter_name ) const {
+        const size_t slot = index.slot_of( parameter_name );
+        if ( no_slot == slot ) {
+            const std::string what_happened = lib_prefix() 
+                                              + "Parameter '" + parameter_name + "' is incorrect (no such parameter)!";
+            throw std::invalid_argument( what_happened );
+        } else {}
+        return slot;
+    }
+
+    void check_value_existence_of( const parameter& registered_parameter, bool value_is_inputed ) const {
+        if ( !registered_parameter.takes_value() ) {
+            const std::string what_happened = lib_prefix() 
+                                              + "Parameter '" + registered_parameter.short_name 
+                                              + "' registered without value!";
+            throw std::logic_error( what_happened );
+        } else if ( !value_is_inputed && !registered_parameter.has_default_value() ) {
+            const std::string what_happened = lib_prefix() 
+                                              + "Parameter '" + registered_parameter.short_name 
+                                              + "' is not inputed and has no default value!";
+            throw std::logic_error( what_happened );
+        } else {}
+    }
+
+    template< typename ArgType >
+    void check_type_of_value( const parameter& registered_parameter ) const {
+        const argument_holder_base& holder = *registered_parameter.holder;
+        if ( typeid( ArgType ) != holder.argument_type() ) {
+            throw std::invalid_argument( holder.conversion_error_report( registered_parameter.short_name ) );
+        } else {}
+    }
+private:
+    /// Conversion (and check of semantic, maybe in filesystem) is done without locking.
+    template< typename ArgType >
+    const ArgType& converted_value( const parameter& registered_parameter, const inputed_value& value ) const {
+        boost::shared_ptr< const any > converted = boost::atomic_load( &value.converted );
+        if ( !converted ) {
+            const str_view inputed_value( values.data() + value.begin, value.size );
+            check_semantic( registered_parameter, inputed_value );
+            boost::shared_ptr< const any > new_converted = 
+                    boost::make_shared< any >( caster.cast< ArgType >( inputed_value, registered_parameter.short_name ) );
+            if ( boost::atomic_compare_exchange( &value.converted, &converted, new_converted ) ) {
+                converted = new_converted;
+            } else {}
+        } else {}
+        return *boost::any_cast< ArgType >( converted.get() );
+    }
+
+    /// Default value is stored in registered parameter (parser outlives its results).
+    /// Default path of frozen parser is already checked.
+    template< typename ArgType >
+    const ArgType& default_value( size_t slot ) const {
+        const parameter& registered_parameter = registered_parameters[slot];
+        const typed_argument_holder< ArgType >& holder = 
+                static_cast< const typed_argument_holder< ArgType >& >( *registered_parameter.holder );
+        if ( !holder.argument_is_string() ) {
+            return holder.default_value;
+        } else {}
+
+        const std::string& value = registered_parameter.default_string_value();
+        if ( path == registered_parameter.semantic && tables.default_paths_are_checked() ) {
+            report_semantic_problem_if( !tables.default_path_exists( slot ), registered_parameter, value );
+        } else {
+            check_semantic( registered_parameter, value );
+        }
+        return holder.default_value;
+    }
+
+
+    void check_semantic( const parameter& registered_parameter, const str_view& value ) const {
+        report_semantic_problem_if( !semantic_is_correct( registered_parameter.semantic, value ), registered_parameter, value );
+    }
+
+    void report_semantic_problem_if( bool                   value_is_incorrect
+                                     , const parameter&     registered_parameter
+                                     , const str_view&      value ) const {
+        if ( value_is_incorrect ) {
+            throw std::invalid_argument( semantic_error_report( registered_parameter.semantic
+                                                                , value
+                                                                , registered_parameter.short_name ) );
+        } else {}
+    }
+
+    /// Path is checked by parser's checker, so its existence is memoized in frozen parser.
+    bool semantic_is_correct( value_semantic semantic, const str_view& value ) const {
+        if ( path != semantic ) {
+            return value_semantic_is_correct( semantic, value );
+        } else {}
+
+        const str_views paths( 1, value );
+        existence_marks existence;
+        path_checker.check( paths, existence );
+        return 0 != existence[0];
+    }
+private:
+    argument_caster caster;
+};
+
+/// \class parse_result
+/// \brief Result of parsing without calling of user's functions.
+///
+/// Copy of result is cheap (all copies share the same values), and result can be 
+/// passed to another thread or read from several threads. Parser must outlive its results.
+/// Parsing into result that has no copies reuses its memory.
+class parse_result {
+public:
+    parse_result() {}
+
+private:
+    boost::shared_ptr< parse_result_data > data;
+public:
+    /// Data for parsing into this result (used by parser). Data of previous parsing 
+    /// is reused if it's not shared with copies of result, otherwise new data is created.
+    parse_result_data& data_for_parsing( const parameters&          registered_parameters
+                                         , const parameters_index&  index
+                                         , const parameters_tables& tables
+                                         , const path_checks&       path_checker ) {
+        if ( !data || !data.unique() || !data->parsed_by( registered_parameters ) ) {
+            data = boost::make_shared< parse_result_data >( registered_parameters, index, tables, path_checker );
+        } else {}
+        return *data;
+    }
+public:
+    /// Is parameter (by short or full name) inputed?
+    bool inputed( const std::string& parameter_name ) const {
+        return get_data().inputed( parameter_name );
+    }
+
+    /// Inputed (or default) value of parameter (by short or full name). Value is converted 
+    /// and its semantic is checked at first reading, so errors are reported here (by exceptions).
+    /// 'ArgType' must be the same type as in parameter's registration.
+    template< typename ArgType >
+    const ArgType& value( const std::string& parameter_name ) const {
+        return get_data().value< ArgType >( parameter_name );
+    }
+
+    bool empty() const { return !data; }
+
+    void swap( parse_result& another ) { data.swap( another.data ); }
+private:
+    parse_result_data& get_data() const {
+        if ( !data ) {
+            const std::string what_happened = lib_prefix() + "Parse result is empty (nothing was parsed into it)!";
+            throw std::logic_error( what_happened );
+        } else {}
+        return *data;
+    }
+};
+
+} // namespace detail
+
+typedef detail::parse_result parse_result;
+
+} // namespace clpp
+
+#endif // CLPP_DETAIL_PARSE_RESULT_HPP
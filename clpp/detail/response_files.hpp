@@ -0,0 +1,155 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+#ifndef CLPP_DETAIL_RESPONSE_FILES_HPP
+#define CLPP_DETAIL_RESPONSE_FILES_HPP
+
+#include "types.hpp"
+#include "misc.hpp"
+#include "shell_words_splitter.hpp"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/ptr_container/ptr_vector.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <algorithm>
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// \namespace clpp::detail
+/// \brief Details of realization.
+namespace detail {
+
+/// Inputed parameter '@path' is a response file (but single '@' is not).
+inline bool this_is_response_file( const str_view& inputed_parameter ) {
+    return inputed_parameter.size() > 1 && '@' == inputed_parameter[0];
+}
+
+/// \class response_files_expander
+/// \brief Expander of response files.
+///
+/// Response file contains inputed parameters separated by spaces or line ends, with shell-like 
+/// quoting (see 'shell_words_reader'). It can include other response files ('@path' inside),
+/// relative paths are relative to current directory. Cyclic inclusion is an error.
+///
+/// Files are mapped in memory (copy-on-write, so quotes are removed in place, without changing 
+/// of file), and parameters are views into mapped regions, without copying. Regions are kept 
+/// until 'release()', so they must outlive parsing.
+class response_files_expander : boost::noncopyable {
+    typedef boost::interprocess::mapped_region  region;
+    typedef boost::ptr_vector< region >         regions;
+public:
+    response_files_expander() {}
+private:
+    regions         mapped_files;
+    /// Canonical paths of files that are being expanded now (for detection of cycles).
+    str_storage     files_in_progress;
+public:
+    /// Inputed parameters from file are appended to 'inputed_parameters'.
+    /// Returns false if file cannot be expanded, 'what_happened' describes why.
+    bool expand( const str_view&    response_file
+                 , str_views&       inputed_parameters
+                 , std::string&     what_happened ) {
+        files_in_progress.clear();
+        return expand_file( response_file.substr( 1 ).to_string(), inputed_parameters, what_happened );
+    }
+
+    void release() {
+        mapped_files.clear();
+    }
+private:
+    bool expand_file( const std::string&    path
+                      , str_views&          inputed_parameters
+                      , std::string&        what_happened ) {
+        boost::system::error_code error;
+        const std::string canonical_path = boost::filesystem::canonical( path, error ).string();
+        if ( error || !boost::filesystem::is_regular_file( canonical_path, error ) ) {
+            what_happened = lib_prefix() + "Response file '" + path + "' cannot be read!";
+            return false;
+        } else {}
+        
+        if ( files_in_progress.end() != std::find( files_in_progress.begin()
+                                                   , files_in_progress.end()
+                                                   , canonical_path ) ) {
+            what_happened = lib_prefix() + "Response file '" + path + "' includes itself (maybe indirectly)!";
+            return false;
+        } else {}
+
+        if ( 0 == boost::filesystem::file_size( canonical_path, error ) ) {
+            return !error;
+        } else {}
+
+        region* mapped_file = map( canonical_path, path, what_happened );
+        if ( 0 == mapped_file ) {
+            return false;
+        } else {}
+
+        files_in_progress.push_back( canonical_path );
+        const bool expanded = expand_mapped( *mapped_file, path, inputed_parameters, what_happened );
+        files_in_progress.pop_back();
+        return expanded;
+    }
+
+    /// Returns 0 if file cannot be mapped (for example, without permission), 'what_happened' describes why.
+    region* map( const std::string& canonical_path, const std::string& path, std::string& what_happened ) {
+        using namespace boost::interprocess;
+        try {
+            file_mapping file( canonical_path.c_str(), read_only );
+            mapped_files.push_back( new region( file, copy_on_write ) );
+        } catch ( const interprocess_exception& exc ) {
+            what_happened = lib_prefix() + "Response file '" + path + "' cannot be read (" + exc.what() + ")!";
+            return 0;
+        }
+        region& mapped_file = mapped_files.back();
+        mapped_file.advise( region::advice_sequential );
+        return &mapped_file;
+    }
+
+    bool expand_mapped( region&                 mapped_file
+                        , const std::string&    path
+                        , str_views&            inputed_parameters
+                        , std::string&          what_happened ) {
+        char* const begin = static_cast< char* >( mapped_file.get_address() );
+        shell_words_reader read( begin, begin + mapped_file.get_size() );
+        char* word_begin = 0;
+        char* word_end = 0;
+        while ( read.next( word_begin, word_end ) ) {
+            const str_view inputed_parameter( word_begin, static_cast< size_t >( word_end - word_begin ) );
+            if ( !this_is_response_file( inputed_parameter ) ) {
+                inputed_parameters.push_back( inputed_parameter );
+            } else if ( !expand_file( inputed_parameter.substr( 1 ).to_string(), inputed_parameters, what_happened ) ) {
+                return false;
+            } else {}
+        }
+        if ( read.quote_is_unterminated() ) {
+            what_happened = lib_prefix() + "Unterminated quote in response file '" + path + "'!";
+            return false;
+        } else {}
+        return true;
+    }
+};
+
+} // namespace detail
+} // namespace clpp
+
+#endif // CLPP_DETAIL_RESPONSE_FILES_HPP
@@ -0,0 +1,183 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+#ifndef CLPP_DETAIL_SHELL_WORDS_SPLITTER_HPP
+#define CLPP_DETAIL_SHELL_WORDS_SPLITTER_HPP
+
+#include "types.hpp"
+#include "misc.hpp"
+
+#include <stdexcept>
+#include <algorithm>
+#include <vector>
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// \namespace clpp::detail
+/// \brief Details of realization.
+namespace detail {
+
+/// \class shell_words_reader
+/// \brief Reader of words with shell-like quoting, in place.
+///
+/// Words are separated by spaces, tabs or line ends. Supports single quotes (all literally),
+/// double quotes (backslash escapes only '"', '\', '$' and '`') and backslash outside quotes.
+/// Quotes and escapes are removed by moving symbols of word to the left, in the same memory
+/// (word never becomes longer), so words are not copied anywhere. Symbol after every word 
+/// can be overwritten by caller (for example, by null-terminator).
+class shell_words_reader {
+public:
+    shell_words_reader( char* begin, char* _end ) : 
+            next_symbol( begin )
+            , end( _end )
+            , unterminated_quote( false ) {}
+private:
+    char*       next_symbol;
+    char* const end;
+    bool        unterminated_quote;
+public:
+    /// Returns false if there are no more words, or if quote is unterminated.
+    bool next( char*& word_begin, char*& word_end ) {
+        skip_separators();
+        if ( end == next_symbol ) {
+            return false;
+        } else {}
+
+        word_begin = next_symbol;
+        char* out = next_symbol;
+        char* p = next_symbol;
+        for ( ; end != p && !is_separator( *p ); ++p ) {
+            const char symbol = *p;
+            if ( '\\' == symbol ) {
+                p = read_escaped_symbol( p, out );
+            } else if ( '\'' == symbol ) {
+                p = read_single_quoted( p + 1, out );
+            } else if ( '"' == symbol ) {
+                p = read_double_quoted( p + 1, out );
+            } else {
+                *out++ = symbol;
+            }
+            if ( unterminated_quote ) {
+                return false;
+            } else {}
+        }
+        word_end = out;
+        next_symbol = ( end == p ) ? end : p + 1;
+        return true;
+    }
+
+    bool quote_is_unterminated() const { return unterminated_quote; }
+private:
+    static bool is_separator( char symbol ) {
+        return ' ' == symbol || '\t' == symbol || '\n' == symbol || '\r' == symbol;
+    }
+
+    void skip_separators() {
+        while ( end != next_symbol && is_separator( *next_symbol ) ) {
+            ++next_symbol;
+        }
+    }
+
+    /// Backslash at the end stays as is.
+    char* read_escaped_symbol( char* backslash, char*& out ) const {
+        char* p = ( end == backslash + 1 ) ? backslash : backslash + 1;
+        *out++ = *p;
+        return p;
+    }
+
+    char* read_single_quoted( char* p, char*& out ) {
+        char* closing_quote = std::find( p, end, '\'' );
+        if ( end == closing_quote ) {
+            unterminated_quote = true;
+            return end;
+        } else {}
+        out = std::copy( p, closing_quote, out );
+        return closing_quote;
+    }
+
+    char* read_double_quoted( char* p, char*& out ) {
+        for ( ; p != end; ++p ) {
+            if ( '"' == *p ) {
+                return p;
+            } else if ( '\\' == *p && end != p + 1 && escapable_in_double_quotes( p[1] ) ) {
+                ++p;
+            } else {}
+            *out++ = *p;
+        }
+        unterminated_quote = true;
+        return end;
+    }
+
+    static bool escapable_in_double_quotes( char symbol ) {
+        return '"' == symbol || '\\' == symbol || '$' == symbol || '`' == symbol;
+    }
+};
+
+/// \class shell_words_splitter
+/// \brief Splitter of command line into words, with shell-like quoting (see 'shell_words_reader').
+///
+/// Line is copied in own buffer and words are read in it, as null-terminated strings, 
+/// so they can be passed to parser like 'argv'. Splitter keeps its buffers between calls.
+class shell_words_splitter {
+    typedef std::vector< char >     chars;
+    typedef std::vector< char* >    pointers;
+public:
+    shell_words_splitter() {}
+private:
+    chars       words;
+    pointers    words_pointers;
+public:
+    void operator()( const str_view& line ) {
+        words.assign( line.begin(), line.end() );
+        words.push_back( '\0' ); // For null-terminator of the last word.
+        words_pointers.clear();
+
+        char* const begin = &words[0];
+        shell_words_reader read( begin, begin + line.size() );
+        char* word_begin = 0;
+        char* word_end = 0;
+        while ( read.next( word_begin, word_end ) ) {
+            *word_end = '\0';
+            words_pointers.push_back( word_begin );
+        }
+        if ( read.quote_is_unterminated() ) {
+            notify_about_unterminated_quote_in( line );
+        } else {}
+
+        words_pointers.push_back( 0 );
+    }
+
+    bool no_words() const { return 1 == words_pointers.size(); }
+    
+    int argc() const { return static_cast< int >( words_pointers.size() - 1 ); }
+
+    char** argv() { return &words_pointers[0]; }
+private:
+    void notify_about_unterminated_quote_in( const str_view& line ) const {
+        const std::string what_happened = lib_prefix() 
+                                          + "Unterminated quote in command line '" + line.to_string() + "'!";
+        throw std::runtime_error( what_happened );
+    }
+};
+
+} // namespace detail
+} // namespace clpp
+
+#endif // CLPP_DETAIL_SHELL_WORDS_SPLITTER_HPP
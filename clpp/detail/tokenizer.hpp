@@ -0,0 +1,111 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+#ifndef CLPP_DETAIL_TOKENIZER_HPP
+#define CLPP_DETAIL_TOKENIZER_HPP
+
+#include "parameters_index.hpp"
+#include "types.hpp"
+
+#include <boost/foreach.hpp>
+
+#include <cstring>
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// \namespace clpp::detail
+/// \brief Details of realization.
+namespace detail {
+
+/// \struct token
+/// \brief Inputed parameter, split into parts.
+///
+/// Parts are views into inputed parameter (or into registered parameter's name,
+/// for unnamed parameter), so token doesn't own any string.
+struct token {
+    str_view    inputed_parameter;
+    str_view    name;
+    str_view    value;
+    size_t      separator_position;
+    size_t      slot;
+    bool        separator_repeated;
+    bool        bound_by_order;
+public:
+    bool has_value() const { return bound_by_order || std::string::npos != separator_position; }
+    bool is_registered() const { return no_slot != slot; }
+};
+
+typedef std::vector< token, arena_allocator< token > > tokens;
+typedef tokens::iterator            token_it;
+typedef tokens::const_iterator      token_const_it;
+
+/// \class tokenizer
+/// \brief Splits inputed parameters into tokens.
+///
+/// Each inputed parameter splits only once, and its name resolves to 
+/// the slot of registered parameter at the same time. All next stages
+/// of parsing works with tokens only.
+class tokenizer {
+public:
+    tokenizer( const parameters_index&  _index
+               , const std::string&     _name_value_separator ) :
+            index( _index )
+            , name_value_separator( _name_value_separator ) {}
+private:
+    const parameters_index& index;
+    const std::string&      name_value_separator;
+public:
+    void operator()( const str_views& inputed_parameters, tokens& inputed_tokens ) const {
+        inputed_tokens.clear();
+        inputed_tokens.reserve( inputed_parameters.size() );
+        BOOST_FOREACH ( const str_view& inputed_parameter, inputed_parameters ) {
+            inputed_tokens.push_back( split( inputed_parameter ) );
+        }
+    }
+private:
+    token split( const str_view& inputed_parameter ) const {
+        token t;
+        t.inputed_parameter  = inputed_parameter;
+        t.separator_position = position_of_separator_in( inputed_parameter );
+        t.separator_repeated = false;
+        t.bound_by_order     = false;
+        if ( std::string::npos != t.separator_position ) {
+            t.name  = inputed_parameter.substr( 0, t.separator_position );
+            t.value = inputed_parameter.substr( t.separator_position + 1 );
+            t.separator_repeated = std::string::npos != position_of_separator_in( t.value );
+        } else {
+            t.name = inputed_parameter;
+        }
+        t.slot = index.slot_of( t.name );
+        return t;
+    }
+
+    /// Separator is always one symbol, so it's searched by 'memchr' (values can be long, like lists).
+    size_t position_of_separator_in( const str_view& part ) const {
+        const void* separator = std::memchr( part.data(), name_value_separator[0], part.size() );
+        return 0 != separator ? static_cast< size_t >( static_cast< const char* >( separator ) - part.data() )
+                              : std::string::npos;
+    }
+};
+
+} // namespace detail
+} // namespace clpp
+
+#endif // CLPP_DETAIL_TOKENIZER_HPP
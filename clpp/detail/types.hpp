@@ -19,7 +19,10 @@
 #ifndef CLPP_DETAIL_TYPES_HPP
 #define CLPP_DETAIL_TYPES_HPP
 
+#include "parse_arena.hpp"
+
 #include <boost/any.hpp>
+#include <boost/utility/string_ref.hpp>
 
 #include <vector>
 #include <sstream>
@@ -36,10 +39,17 @@ typedef std::vector< std::string >  str_storage;
 typedef str_storage::iterator       str_it;
 typedef str_storage::const_iterator str_const_it;
 
+typedef boost::string_ref           str_view;
+typedef std::vector< str_view, arena_allocator< str_view > > str_views;
+typedef str_views::const_iterator   str_views_const_it;
+
 typedef std::ostringstream          o_stream;
 
 typedef boost::any                  any;
 
+/// Slot of unregistered parameter.
+const size_t no_slot = static_cast< size_t >( -1 );
+
 } // namespace detail
 } // namespace clpp
 
@@ -20,7 +20,8 @@
 #define CLPP_DETAIL_UNNAMED_PARAMETERS_HANDLER_HPP
 
 #include "parameter.hpp"
-#include "parameter_parts_extractor.hpp"
+#include "parameters_tables.hpp"
+#include "tokenizer.hpp"
 
 /// \namespace clpp
 /// \brief Main namespace of library.
@@ -35,70 +36,52 @@ namespace detail {
 ///
 /// Handle unnamed inputed parameters.
 /// Assumed that unnamed parameter registered with 'order()' function.
+/// Token of unnamed parameter binds to slot of registered parameter directly
+/// (by order number, via lookup table), without rewriting of inputed parameter.
 class unnamed_parameters_handler {
 public:
-    unnamed_parameters_handler( const parameters&                     _registered_parameters
-                                , const parameter_parts_extractor&    _extractor
-                                , const std::string&                  _name_value_separator ) :
+    unnamed_parameters_handler( const parameters&           _registered_parameters
+                                , const orders_storage&     _registered_orders
+                                , const parameters_tables&  _tables ) :
             registered_parameters( _registered_parameters )
-            , extractor( _extractor )
-            , name_value_separator( _name_value_separator ) {}
+            , registered_orders( _registered_orders )
+            , tables( _tables ) {}
 private:
-    const parameters&                registered_parameters;
-    const parameter_parts_extractor& extractor;
-    const std::string&               name_value_separator;
+    const parameters&           registered_parameters;
+    const orders_storage&       registered_orders;
+    const parameters_tables&    tables;
 public:
-    void operator()( str_storage& inputed_parameters ) const {
-        if ( no_registered_unnamed_parameters() ) {
-            return;
-        } else {}
-
-        for ( size_t i = 0; i < inputed_parameters.size(); ++i ) {
-            std::string& inputed_parameter = inputed_parameters[i];
-            if ( this_is_unnamed_parameter( inputed_parameter ) ) {
-                handle_unnamed_parameter( i, inputed_parameter );
-            } else {}
-        }
-    }
-private:
-    bool no_registered_unnamed_parameters() const {
-        return parameter::orders.empty();
+    bool this_is_unnamed_parameter( const token& inputed_token ) const {
+        return !no_registered_unnamed_parameters()
+               && !inputed_token.has_value() 
+               && !inputed_token.is_registered();
     }
 
-    bool this_is_unnamed_parameter( const std::string& inputed_parameter ) const {
-        return !boost::contains( inputed_parameter, name_value_separator )
-               && this_is_not_name( inputed_parameter );
-    }
-    
-    bool this_is_not_name( const std::string& inputed_parameter ) const {
-        parameter_const_it it = std::find( registered_parameters.begin()
-                                           , registered_parameters.end()
-                                           , inputed_parameter );
-        return registered_parameters.end() == it;
-    }
+    bool bind( size_t inputed_parameter_index, token& inputed_token ) const {
+        const size_t slot = tables.slot_by_order( inputed_parameter_index + 1 );
+        if ( no_slot == slot ) {
+            return false;
+        } else {}
 
-    void handle_unnamed_parameter( size_t inputed_parameter_index, std::string& inputed_parameter ) const {
-        const size_t inputed_parameter_serial_number = inputed_parameter_index + 1;
-        parameter_const_it it = std::find( registered_parameters.begin()
-                                           , registered_parameters.end()
-                                           , inputed_parameter_serial_number );
-        if ( registered_parameters.end() != it ) {
-            const std::string value_of_unnamed_parameter = inputed_parameter;
-            inputed_parameter = it->short_name + name_value_separator + value_of_unnamed_parameter;
-        } else {
-            notify_about_missing_of_parameter_with_serial_number( inputed_parameter
-                                                                  , inputed_parameter_serial_number );
-        }
+        inputed_token.slot           = slot;
+        inputed_token.name           = registered_parameters[slot].short_name;
+        inputed_token.value          = inputed_token.inputed_parameter;
+        inputed_token.bound_by_order = true;
+        return true;
     }
 
-    void notify_about_missing_of_parameter_with_serial_number( const std::string& inputed_parameter
-                                                               , size_t serial_number ) const {
+    std::string missing_of_parameter_with_serial_number_report( const str_view& inputed_parameter
+                                                                , size_t serial_number ) const {
         o_stream what_happened;
         what_happened << lib_prefix() 
                       << "You inputed unnamed parameter '" << inputed_parameter << "' "
                       << "with order number " << serial_number << ", "
                       << "but there is no parameter with such order number!";
-        throw std::runtime_error( what_happened.str() );
+        return what_happened.str();
+    }
+private:
+    bool no_registered_unnamed_parameters() const {
+        return registered_orders.empty();
     }
 };
 
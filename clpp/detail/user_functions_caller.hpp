@@ -20,10 +20,10 @@
 #define CLPP_DETAIL_USER_FUNCTIONS_CALLER_HPP
 
 #include "parameter.hpp"
-#include "parameter_parts_extractor.hpp"
-#include "argument_caster.hpp"
+#include "parameters_tables.hpp"
+#include "tokenizer.hpp"
 
-#include <boost/assign.hpp>
+#include <boost/foreach.hpp>
 
 /// \namespace clpp
 /// \brief Main namespace of library.
@@ -33,8 +33,6 @@ namespace clpp {
 /// \brief Details of realization.
 namespace detail {
 
-using namespace boost::assign;
-
 /// \class user_functions_caller
 /// \brief User's function caller.
 ///
@@ -43,103 +41,82 @@ using namespace boost::assign;
 /// Exception occurs in the user's functions are NOT handled (take care of this yourself).
 class user_functions_caller {
 public:
-    user_functions_caller( const parameters&                    _registered_parameters
-                           , const parameter_parts_extractor&   _extractor
-                           , const std::string&                 _name_value_separator ) :
+    user_functions_caller( const parameters&           _registered_parameters
+                           , const parameters_tables&  _tables ) :
             registered_parameters( _registered_parameters )
-            , extractor( _extractor )
-            , name_value_separator( _name_value_separator ) {}
+            , tables( _tables ) {}
 private:
-    const parameters&                registered_parameters;
-    const parameter_parts_extractor& extractor;
-    const std::string&               name_value_separator;
-    argument_caster                  caster;
+    const parameters&           registered_parameters;
+    const parameters_tables&    tables;
 public:
-    void call( const str_storage& inputed_parameters ) const {
-    	str_storage all_names = collect_names_of_all_registered_parameters();
-        call_functions_for_parameters_without_values( inputed_parameters, all_names );
-        call_functions_for_parameters_with_inputed_values( inputed_parameters, all_names );
-        call_functions_for_parameters_with_default_values( all_names ); 
+    /// Inputed slots marks are obtained from validation engine.
+    /// Returns quantity of called functions.
+    template< typename Instrumentation >
+    size_t call( const tokens&          inputed_tokens
+                 , const slots_marks&   inputed_slots
+                 , Instrumentation&     instruments ) const {
+        return call_functions_for_parameters_without_values( inputed_tokens, instruments )
+               + call_functions_for_parameters_with_inputed_values( inputed_tokens, instruments )
+               + call_functions_for_parameters_with_default_values( inputed_slots, instruments ); 
     }
-private:
-    str_storage collect_names_of_all_registered_parameters() const {
-        str_storage all_names;
-    	BOOST_FOREACH ( const parameter& registered_parameter, registered_parameters ) {
-    		all_names += registered_parameter.short_name;
-    	}
-        return all_names;
-    } 
 private: 
-    void call_functions_for_parameters_without_values( const str_storage&  inputed_parameters
-                                                       , str_storage&      all_names ) const {
-        BOOST_FOREACH ( const std::string& inputed_parameter, inputed_parameters ) {
-            if ( this_is_parameter_without_value( inputed_parameter ) ) {
-                const std::string name = inputed_parameter;
-                parameter_const_it it = std::find( registered_parameters.begin()
-                                                   , registered_parameters.end()
-                                                   , name );
-                if ( registered_parameters.end() != it ) {
-                    if ( !it->func_without_arg.empty() ) {
-                        it->func_without_arg();
-                    } else {}
-                    delete_element( all_names, it->short_name );
+    template< typename Instrumentation >
+    size_t call_functions_for_parameters_without_values( const tokens&         inputed_tokens
+                                                         , Instrumentation&    instruments ) const {
+        size_t called = 0;
+        BOOST_FOREACH ( const token& inputed_token, inputed_tokens ) {
+            if ( !inputed_token.has_value() && inputed_token.is_registered() ) {
+                if ( !tables.takes_value( inputed_token.slot ) ) {
+                    const parameter& registered_parameter = registered_parameters[inputed_token.slot];
+                    instruments.function_started( registered_parameter.short_name );
+                    registered_parameter.holder->call_without_value();
+                    instruments.function_finished( registered_parameter.short_name );
+                    ++called;
                 } else {}
-            }
+            } else {}
         }
+        return called;
     }
 
-    void call_functions_for_parameters_with_inputed_values( const str_storage&  inputed_parameters
-                                                            , str_storage&      all_names ) const {
-        BOOST_FOREACH ( const std::string& inputed_parameter, inputed_parameters ) {
-            if ( this_is_parameter_with_value( inputed_parameter ) ) {
-                const std::string name  = extractor.extract_name_from( inputed_parameter );
-                parameter_const_it it = std::find( registered_parameters.begin()
-                                                   , registered_parameters.end()
-                                                   , name );
-                if ( registered_parameters.end() != it ) {
-                    if ( !it->func_without_arg.empty() ) {
-                        it->func_without_arg();
-                    } else {
-                        const std::string value = extractor.extract_value_from( inputed_parameter );
-                        call_func_with_arg( *it, value );
-                    }
-                    delete_element( all_names, it->short_name );
-                } else {}
-            }
+    template< typename Instrumentation >
+    size_t call_functions_for_parameters_with_inputed_values( const tokens&         inputed_tokens
+                                                              , Instrumentation&    instruments ) const {
+        size_t called = 0;
+        BOOST_FOREACH ( const token& inputed_token, inputed_tokens ) {
+            if ( inputed_token.has_value() && inputed_token.is_registered() ) {
+                const parameter& registered_parameter = registered_parameters[inputed_token.slot];
+                instruments.function_started( registered_parameter.short_name );
+                if ( !tables.takes_value( inputed_token.slot ) ) {
+                    registered_parameter.holder->call_without_value();
+                } else {
+                    call_func_with_arg( registered_parameter, inputed_token.value );
+                }
+                instruments.function_finished( registered_parameter.short_name );
+                ++called;
+            } else {}
         }
-    }
-    
-    bool this_is_parameter_with_value( const std::string& inputed_parameter ) const {
-        return boost::contains( inputed_parameter, name_value_separator );
-    }
-
-    bool this_is_parameter_without_value( const std::string& inputed_parameter ) const {
-        return !boost::contains( inputed_parameter, name_value_separator );
+        return called;
     }
     
     void call_func_with_arg( const parameter& registered_parameter
-                             , const std::string& inputed_value ) const {
-        const any& for_arg = registered_parameter.for_arg;
-        const std::string name = registered_parameter.short_name;
-        caster.call_func_with_inputed_arg( for_arg, name, inputed_value ); 
+                             , const str_view& inputed_value ) const {
+        registered_parameter.holder->call_with_inputed_value( inputed_value, registered_parameter.short_name );
     }
 private:
-    void call_functions_for_parameters_with_default_values( const str_storage& all_names ) const {
-        BOOST_FOREACH ( const parameter& registered_parameter, registered_parameters ) {
-    		str_const_it it = std::find( all_names.begin()
-                                         , all_names.end()
-                                         , registered_parameter.short_name );
-            if ( all_names.end() != it ) {
-                call_func_with_default_arg( registered_parameter ); 
+    template< typename Instrumentation >
+    size_t call_functions_for_parameters_with_default_values( const slots_marks&    inputed_slots
+                                                              , Instrumentation&    instruments ) const {
+        size_t called = 0;
+        BOOST_FOREACH ( size_t slot, tables.slots_with_default_value ) {
+            if ( !inputed_slots[slot] && tables.takes_value( slot ) ) {
+                const parameter& registered_parameter = registered_parameters[slot];
+                instruments.function_started( registered_parameter.short_name );
+                registered_parameter.holder->call_with_default_value();
+                instruments.function_finished( registered_parameter.short_name );
+                ++called;
             } else {}
     	}
-    }
-
-    void call_func_with_default_arg( const parameter& registered_parameter ) const {
-        if ( registered_parameter.has_default_value() && registered_parameter.func_without_arg.empty() ) {
-            const any& for_arg = registered_parameter.for_arg;
-            caster.call_func_with_default_arg( for_arg ); 
-        } else {}
+        return called;
     }
 };
 
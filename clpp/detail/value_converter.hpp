@@ -0,0 +1,280 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+#ifndef CLPP_DETAIL_VALUE_CONVERTER_HPP
+#define CLPP_DETAIL_VALUE_CONVERTER_HPP
+
+#include "types.hpp"
+
+#include <boost/lexical_cast/try_lexical_convert.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#if __cplusplus >= 201703L
+#include <charconv>
+#endif
+
+#if defined( __cpp_lib_to_chars ) && __cpp_lib_to_chars >= 201611L
+#define CLPP_FLOATING_FROM_CHARS
+#endif
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// \namespace clpp::detail
+/// \brief Details of realization.
+namespace detail {
+
+/// Converts inputed value without exceptions, returns false if value is incorrect 
+/// (argument is not changed then, so failed parsing doesn't damage user's variable).
+/// Integer and floating types are converted without locale and memory allocation,
+/// std::string is just assigned, all other types (chars, bool and user's types) are converted 
+/// via lexical_cast. Lists ('std::vector' of any of these types) are converted element by element.
+template< typename ArgType >
+inline bool convert_value( const str_view& inputed_value, ArgType& argument ) {
+    ArgType value;
+    if ( !boost::conversion::try_lexical_convert( inputed_value.data(), inputed_value.size(), value ) ) {
+        return false;
+    } else {}
+    argument = value;
+    return true;
+}
+
+/// Any value is correct string, so memory of argument is reused.
+inline bool convert_value( const str_view& inputed_value, std::string& argument ) {
+    argument.assign( inputed_value.data(), inputed_value.size() );
+    return true;
+}
+
+/// Digits only, with exact overflow detection: value must not be greater than 'limit'.
+template< typename UnsignedType >
+inline bool accumulate_digits( const char* p, const char* end, UnsignedType limit, UnsignedType& magnitude ) {
+    if ( end == p ) {
+        return false;
+    } else {}
+
+    magnitude = 0;
+    for ( ; p != end; ++p ) {
+        const UnsignedType digit = static_cast< unsigned char >( *p ) - static_cast< unsigned char >( '0' );
+        if ( digit > 9 || magnitude > ( limit - digit ) / 10 ) {
+            return false;
+        } else {}
+        magnitude = static_cast< UnsignedType >( magnitude * 10 + digit );
+    }
+    return true;
+}
+
+/// Optional '+' and digits. Unlike lexical_cast, negative value is incorrect.
+template< typename UnsignedType >
+inline bool convert_unsigned_integer( const str_view& inputed_value, UnsignedType& argument ) {
+    const char* p = inputed_value.begin();
+    const char* const end = inputed_value.end();
+    if ( end != p && '+' == *p ) {
+        ++p;
+    } else {}
+    UnsignedType magnitude = 0;
+    if ( !accumulate_digits( p, end, std::numeric_limits< UnsignedType >::max(), magnitude ) ) {
+        return false;
+    } else {}
+    argument = magnitude;
+    return true;
+}
+
+/// Optional sign and digits.
+template< typename SignedType >
+inline bool convert_signed_integer( const str_view& inputed_value, SignedType& argument ) {
+    typedef typename boost::make_unsigned< SignedType >::type unsigned_type;
+    
+    const char* p = inputed_value.begin();
+    const char* const end = inputed_value.end();
+    const bool negative = end != p && '-' == *p;
+    if ( end != p && ( '-' == *p || '+' == *p ) ) {
+        ++p;
+    } else {}
+
+    const unsigned_type max = static_cast< unsigned_type >( std::numeric_limits< SignedType >::max() );
+    unsigned_type magnitude = 0;
+    if ( !accumulate_digits( p, end, negative ? static_cast< unsigned_type >( max + 1 ) : max, magnitude ) ) {
+        return false;
+    } else {}
+    
+    if ( negative ) {
+        argument = 0 == magnitude ? 0 
+                                  : static_cast< SignedType >( -static_cast< SignedType >( magnitude - 1 ) - 1 );
+    } else {
+        argument = static_cast< SignedType >( magnitude );
+    }
+    return true;
+}
+
+/// Digit other than '0' before exponent: such value is not zero.
+inline bool mantissa_is_not_zero( const str_view& inputed_value ) {
+    for ( const char* p = inputed_value.begin(); p != inputed_value.end() && 'e' != *p && 'E' != *p; ++p ) {
+        if ( *p >= '1' && *p <= '9' ) {
+            return true;
+        } else {}
+    }
+    return false;
+}
+
+/// Underflow (non-zero value converted into zero or into subnormal number) is incorrect.
+/// Checked after both ways of conversion, because they treat underflow differently:
+/// 'std::from_chars' rejects some of such values, lexical_cast accepts all of them.
+template< typename FloatingType >
+inline bool floating_value_is_in_range( const str_view& inputed_value, FloatingType value ) {
+    const FloatingType min = std::numeric_limits< FloatingType >::min();
+    const bool underflow = value < min && value > -min && mantissa_is_not_zero( inputed_value );
+    return !underflow;
+}
+
+/// With 'std::from_chars' (when available) value is converted without locale and exceptions,
+/// otherwise via lexical_cast. Leading plus and out of range values are treated the same way
+/// in both cases. Argument is changed only if value is correct.
+template< typename FloatingType >
+inline bool convert_floating( const str_view& inputed_value, FloatingType& argument ) {
+    FloatingType value = 0;
+#ifdef CLPP_FLOATING_FROM_CHARS
+    const char* begin = inputed_value.begin();
+    const char* const end = inputed_value.end();
+    // 'std::from_chars' doesn't accept leading plus, unlike lexical_cast.
+    if ( end - begin > 1 && '+' == begin[0] && '-' != begin[1] ) {
+        ++begin;
+    } else {}
+    const std::from_chars_result result = std::from_chars( begin, end, value );
+    const bool converted = std::errc() == result.ec && end == result.ptr;
+#else
+    const bool converted = boost::conversion::try_lexical_convert( inputed_value.data(), inputed_value.size(), value );
+#endif
+    if ( !converted || !floating_value_is_in_range( inputed_value, value ) ) {
+        return false;
+    } else {}
+    argument = value;
+    return true;
+}
+
+inline bool convert_value( const str_view& inputed_value, short int& argument ) {
+    return convert_signed_integer( inputed_value, argument );
+}
+
+inline bool convert_value( const str_view& inputed_value, int& argument ) {
+    return convert_signed_integer( inputed_value, argument );
+}
+
+inline bool convert_value( const str_view& inputed_value, long int& argument ) {
+    return convert_signed_integer( inputed_value, argument );
+}
+
+inline bool convert_value( const str_view& inputed_value, unsigned short int& argument ) {
+    return convert_unsigned_integer( inputed_value, argument );
+}
+
+inline bool convert_value( const str_view& inputed_value, unsigned int& argument ) {
+    return convert_unsigned_integer( inputed_value, argument );
+}
+
+inline bool convert_value( const str_view& inputed_value, unsigned long int& argument ) {
+    return convert_unsigned_integer( inputed_value, argument );
+}
+
+inline bool convert_value( const str_view& inputed_value, float& argument ) {
+    return convert_floating( inputed_value, argument );
+}
+
+inline bool convert_value( const str_view& inputed_value, double& argument ) {
+    return convert_floating( inputed_value, argument );
+}
+
+inline bool convert_value( const str_view& inputed_value, long double& argument ) {
+    return convert_floating( inputed_value, argument );
+}
+
+/// Delimiter of elements in value of list parameter.
+const char list_delimiter = ',';
+
+inline size_t list_size( const str_view& inputed_value ) {
+    return static_cast< size_t >( std::count( inputed_value.begin(), inputed_value.end(), list_delimiter ) ) + 1;
+}
+
+/// Element of list starting at 'p' (till delimiter or end of value).
+inline str_view list_element( const char* p, const char* end ) {
+    const void* delimiter = std::memchr( p, list_delimiter, static_cast< size_t >( end - p ) );
+    return str_view( p, static_cast< size_t >( ( 0 != delimiter ? static_cast< const char* >( delimiter ) : end ) - p ) );
+}
+
+/// Converts elements of list value one by one into 'element', 'store( i, element )' is called 
+/// after every conversion. False if any of elements is incorrect.
+template< typename ElementType, typename Store >
+inline bool convert_list_elements( const str_view& inputed_value, size_t quantity, Store store ) {
+    const char* p = inputed_value.begin();
+    const char* const end = inputed_value.end();
+    ElementType element;
+    for ( size_t i = 0; i < quantity; ++i ) {
+        const str_view inputed_element = list_element( p, end );
+        if ( !convert_value( inputed_element, element ) ) {
+            return false;
+        } else {}
+        store( i, element );
+        p = end != inputed_element.end() ? inputed_element.end() + 1 : end;
+    }
+    return true;
+}
+
+/// Store of converted element that only checks it.
+struct element_check {
+    template< typename ElementType >
+    void operator()( size_t /* i */, const ElementType& /* element */ ) const {}
+};
+
+/// Store of converted element into list.
+template< typename List >
+struct element_store {
+    explicit element_store( List& _list ) :
+            list( _list ) {}
+
+    List& list;
+public:
+    template< typename ElementType >
+    void operator()( size_t i, const ElementType& element ) const {
+        list[i] = element;
+    }
+};
+
+/// List value (for example, "1,2,3") is checked first, and only correct one is converted 
+/// element by element directly into argument, so argument is not changed if any of elements 
+/// is incorrect, and its memory is reused (memory for all elements is allocated once).
+template< typename ElementType, typename Allocator >
+inline bool convert_value( const str_view& inputed_value, std::vector< ElementType, Allocator >& argument ) {
+    typedef std::vector< ElementType, Allocator > list;
+
+    const size_t quantity = list_size( inputed_value );
+    if ( !convert_list_elements< ElementType >( inputed_value, quantity, element_check() ) ) {
+        return false;
+    } else {}
+    argument.resize( quantity );
+    return convert_list_elements< ElementType >( inputed_value, quantity, element_store< list >( argument ) );
+}
+
+} // namespace detail
+} // namespace clpp
+
+#endif // CLPP_DETAIL_VALUE_CONVERTER_HPP
@@ -146,17 +146,22 @@
 /// \li <b>Boost.Algorithm</b>
 /// \li <b>Boost.Bind</b>
 /// \li <b>Boost.Foreach</b>
-/// \li <b>Boost.Asio</b>
 /// \li <b>Boost.Smart_ptr</b>
 /// \li <b>Boost.Function</b>
 /// \li <b>Boost.Filesystem</b>
 /// \li <b>Boost.System</b>
+/// \li <b>Boost.Interprocess</b> (for response files)
 ///
 /// Full list of Boost C++ libraries see \htmlonly<b><a href="http://www.boost.org/doc/libs">there</a></b>\endhtmlonly.
 ///
 /// All used libraries are <b>header-only</b>, except <em>Boost.Filesystem</em> and <em>Boost.System</em>, 
 /// so you must build these libraries and link it with your program.
 ///
+/// Batch parsing (<b>clpp/batch_parser.hpp</b>) additionally uses 
+/// <b>Boost.Atomic</b> and <b>Boost.Thread</b>, so in this case link your program with <em>Boost.Thread</em> too.
+/// Instrumentation (<b>clpp/timing_instrumentation.hpp</b>) uses <b>Boost.Chrono</b>, link your program with it too.
+/// Concurrent paths checks (<b>clpp/concurrent_path_checks.hpp</b>) use <b>Boost.Thread</b>, link your program with it too.
+///
 /// However, if you using C++ professionally, you (in my humble opinion) <em><b>must</b></em> have 
 /// Boost C++ libraries. So just download full package from \htmlonly<b><a href="http://www.boost.org/users/download/">there</a></b>\endhtmlonly, install it and enjoy!
 ///
@@ -186,6 +191,14 @@
 ///         - \ref combine_of_settings
 ///         - \ref another_value_separator
 ///         - \ref unnamed_params
+///         - \ref frozen_parser
+///         - \ref parsing_with_diagnostics
+///         - \ref batch_parsing
+///         - \ref instrumentation
+///         - \ref response_files
+///         - \ref path_checks
+///         - \ref parse_results
+///         - \ref variables
 ///
 /// \htmlonly <hr/> \endhtmlonly
 /// 
@@ -291,6 +304,10 @@
 /// }
 /// \endcode
 ///
+/// <b>add_parameter()</b> returns reference to registered parameter, for its checks and default value.
+/// Registered parameters are stored one after another, so this reference is valid only 
+/// until registration of next parameter.
+///
 /// \htmlonly <br/> \endhtmlonly
 ///
 /// \subsection member_functions Register of functions-members
@@ -341,7 +358,17 @@
 /// 
 /// When you register parameter with value, you can use follow types of function's argument:
 /// \li almost all standard C++-types (see below), 
-/// \li std::string.
+/// \li std::string,
+/// \li your own types, which can be read from stream (with <b>operator>></b>),
+/// \li lists: <b>std::vector</b> of any of these types.
+///
+/// For example:
+/// \code
+/// struct point { int x, y; };
+/// std::istream& operator>>( std::istream& in, point& p ) { /* read "x,y"... */ }
+///
+/// void f( const point& p ) { /* some work... */ }
+/// \endcode
 ///
 /// You CANNOT use <b>const char*</b> and <b>wchar_t</b> argument.
 /// But this limitation, in my humble opinion, is not the real problem.
@@ -357,6 +384,17 @@
 ///
 /// Passing by non-const reference is NOT supported (I think this is completely unnecessary).
 ///
+/// Value of list parameter is elements separated by comma:
+/// \code
+/// void f( const std::vector< int >& ids ) { /* some work... */ }
+/// // ...
+/// parser.add_parameter( "-i", "--ids", f );
+/// \endcode
+/// So for "--ids=1,2,3" your function is called once, with all three numbers. 
+/// Elements are converted directly into vector (memory is allocated once), and if any element 
+/// is incorrect, whole value is incorrect. Elements themselves cannot contain comma, 
+/// and comma cannot be name-value separator in this case.
+///
 /// \htmlonly <hr/> \endhtmlonly
 ///
 /// \section advanced_usage Advanced usage
@@ -613,6 +651,258 @@
 /// # ./program 127.0.0.1 -p=80
 /// \endcode
 ///
+/// \htmlonly <br/> \endhtmlonly
+///
+/// \subsection frozen_parser Parse many times
+///
+/// If you want to parse many command lines with one parser (for example, in long-running service),
+/// freeze it after registration with <b>clpp::command_line_parameters_parser::freeze()</b> function:
+///
+/// \code
+///     // ...
+///     parser.add_parameter( "-c", "--config", config )
+///           .necessary()
+///           ;
+///     parser.freeze();
+///     // ...
+///     parser.parse( argc, argv );
+///     // ...
+///     parser.parse( another_argc, another_argv );
+/// \endcode
+///
+/// All lookup tables are built once, in <b>freeze()</b>, so every parsing is done without repetition
+/// of this work. After that you cannot register new parameters or change 'name-value' separator 
+/// (exception will throw). Settings of already registered parameters (such as <b>necessary()</b>, 
+/// <b>default_value()</b>, <b>order()</b> and <b>check_semantic()</b>) cannot be changed too.
+/// Options that are checked for every inputed parameter are stored in these tables compactly
+/// (byte per parameter), so even schema with thousands of parameters is checked quickly.
+///
+/// Frozen parser can be shared between threads. In this case every thread must use 
+/// its own <b>clpp::parse_context</b>:
+///
+/// \code
+/// void worker( const clpp::command_line_parameters_parser& parser ) {
+///     clpp::parse_context context;
+///     // ...
+///     parser.parse( argc, argv, context );
+///     // ...
+/// }
+/// \endcode
+///
+/// Remember that your functions will be called from these threads.
+/// Parsing doesn't change frozen parser, and all changes of parser and of its registered parameters
+/// are rejected after <b>freeze()</b>, so only your own functions (and your paths existence checker)
+/// should care about thread safety. Concurrent parsing is checked by 'benchmark/concurrent_parsing_stress.cpp'
+/// (build it with ThreadSanitizer).
+///
+/// Context can take all memory needed for parsing from your buffer (it is reused in every parsing):
+///
+/// \code
+///     char buffer[4096];
+///     clpp::parse_context context( buffer, sizeof( buffer ) );
+///     // ...
+///     parser.parse( argc, argv, context );
+///     // context.heap_allocations() is 0, if buffer is big enough.
+/// \endcode
+///
+/// In this case parsing doesn't use heap at all, if your functions have arguments of standard scalar types 
+/// (with C++17 compiler, otherwise floating values are converted via Boost.Lexical_cast).
+///
+/// \htmlonly <br/> \endhtmlonly
+///
+/// \subsection parsing_with_diagnostics Parsing with diagnostics
+///
+/// Usually first found problem is reported by exception. If you want to know about all problems 
+/// in one parsing, use <b>clpp::diagnostics</b>:
+///
+/// \code
+///     clpp::diagnostics problems;
+///     if ( !parser.parse( argc, argv, problems ) ) {
+///         std::cerr << problems.report() << std::endl;
+///     }
+/// \endcode
+///
+/// In this case exceptions are not thrown for incorrect inputed parameters, and your functions 
+/// are called only if no problems found. Every problem (see <b>clpp::problem</b>) has a kind, 
+/// a name of parameter and a report. Incorrect type of value is reported too (before calling of 
+/// any function). Frozen parser can be used with your context: <b>parse( argc, argv, context, problems )</b>.
+///
+/// Reuse the same <b>clpp::diagnostics</b> object: if no problems found, parsing with it doesn't allocate memory.
+///
+/// \htmlonly <br/> \endhtmlonly
+///
+/// \subsection batch_parsing Batch parsing
+///
+/// If you have many command lines in text file (one command line per line, first word is a program name),
+/// you can check all of them against frozen parser with <b>clpp::batch_parser</b>:
+///
+/// \code
+/// #include <clpp/batch_parser.hpp>
+///     // ...
+///     parser.freeze();
+///     clpp::batch_parser batch( parser );
+///     clpp::line_results results;
+///     batch.parse_file( "jobs.txt", results );
+///     for ( size_t i = 0; i < results.size(); ++i ) {
+///         if ( clpp::incorrect_line == results[i].status ) {
+///             std::cout << "line " << i + 1 << ": " << results[i].diagnostic << std::endl;
+///         }
+///     }
+/// \endcode
+///
+/// File is mapped in memory, lines are parsed in parallel (by default, with one thread per core), 
+/// and results are in the original order of lines. Words in line can be quoted like in shell:
+///
+/// \code
+/// job --input="/some/path with spaces" --user='root'
+/// \endcode
+///
+/// \htmlonly <br/> \endhtmlonly
+///
+/// \subsection instrumentation Instrumentation
+///
+/// If you want to know where parsing spends its time, parse with instrumentation 
+/// (parser must be frozen):
+///
+/// \code
+/// #include <clpp/timing_instrumentation.hpp>
+///     // ...
+///     clpp::parse_context context;
+///     clpp::timing_instrumentation timings;
+///     parser.parse( argc, argv, context, timings );
+///     std::cout << timings.phases[clpp::checking_phase].nanoseconds << std::endl;
+/// \endcode
+///
+/// Wall time, quantity of calls, processed items and heap allocations are accumulated 
+/// for every phase of parsing (<b>clpp::parse_phase</b>), for every check (<b>clpp::parse_check</b>) 
+/// and for every your function (by short name of parameter). <b>clpp::timing_instrumentation</b> 
+/// uses <em>Boost.Chrono</em>, so link your program with it.
+///
+/// By default only heap allocations of context are counted. If you count all heap allocations 
+/// (for example, in your replacement of global <b>operator new</b>), give your counter to instrumentation, 
+/// and allocations in your functions and in conversions of values are attributed to them too:
+///
+/// \code
+///     size_t all_allocations(); // Returns quantity of all heap allocations made so far.
+///     // ...
+///     clpp::timing_instrumentation timings( all_allocations );
+/// \endcode
+///
+/// You can write your own instrumentation policy, with the same functions as in <b>clpp::no_instrumentation</b>.
+/// Usual parsing uses <b>clpp::no_instrumentation</b> (all its functions are empty), so it costs nothing.
+///
+/// \htmlonly <br/> \endhtmlonly
+///
+/// \subsection response_files Response files
+///
+/// If command line is too long, parameters can be passed in file. Allow response files before parsing:
+///
+/// \code
+///     parser.allow_response_files();
+///     parser.parse( argc, argv );
+/// \endcode
+///
+/// and run program like this:
+///
+/// \code 
+/// # ./program @params.txt --log-dir=/some/path
+/// \endcode
+///
+/// Parameter <b>@params.txt</b> is replaced by parameters from file <b>params.txt</b>. In file parameters
+/// are separated by spaces or line ends, and can be quoted like in shell (see \ref batch_parsing). 
+/// File can include other files (<b>@other.txt</b>), relative paths are relative to current directory.
+/// If file cannot be read, or includes itself, it's an error (<b>clpp::incorrect_response_file</b> in diagnostics).
+///
+/// File is mapped in memory and parameters are not copied, so even huge response files 
+/// are expanded quickly. 
+///
+/// \htmlonly <br/> \endhtmlonly
+///
+/// \subsection path_checks Paths checks on slow filesystem
+///
+/// Every value with <b>clpp::path</b> semantic is checked in filesystem. On network filesystem 
+/// one check can take milliseconds, so all paths (inputed values and default values) are checked 
+/// together, by one checker. Checker can check paths concurrently:
+///
+/// \code
+/// #include <clpp/concurrent_path_checks.hpp>
+///     // ...
+///     clpp::concurrent_paths_existence_checker checker( 16 ); // 16 threads.
+///     parser.set_paths_existence_checker( checker );
+/// \endcode
+///
+/// Checker must live as long as parser. You can write your own checker, derived from 
+/// <b>clpp::paths_existence_checker</b>. Default checker checks paths one by one.
+///
+/// Check of paths is started right after tokenizing, and its result is taken only before
+/// report of semantic problems, so concurrent checker checks paths meanwhile all other checks 
+/// are done (your own checker can do it too, by overriding <b>start()</b> and <b>finish()</b>).
+///
+/// Frozen parser checks default paths only once, in <b>freeze()</b>, and memoizes existing paths 
+/// (up to several thousands, the oldest ones are forgotten first), so existing path is checked 
+/// in filesystem only once (it's assumed that existing paths don't disappear while program runs).
+/// Nonexistent inputed paths are checked every time, so path created later is found. Memo is shared 
+/// by all parsing threads without locking.
+///
+/// \htmlonly <br/> \endhtmlonly
+///
+/// \subsection parse_results Results instead of functions
+///
+/// If you just want to store values of parameters, you don't need functions for them. 
+/// Register parameters with type of value only, and parse them into result:
+///
+/// \code
+///     clpp::command_line_parameters_parser parser;
+///     parser.add_parameter( "-h", "--help" );
+///     parser.add_parameter< int >( "-t", "--threads" ).default_value( 4 );
+///     parser.add_parameter< std::string >( "-l", "--log-dir" ).check_semantic( clpp::path );
+///     parser.freeze();
+///
+///     clpp::parse_context context;
+///     clpp::parse_result result;
+///     parser.parse( argc, argv, context, result );
+///     
+///     if ( result.inputed( "--help" ) ) {
+///         // ...
+///     }
+///     const int threads = result.value< int >( "--threads" );
+/// \endcode
+///
+/// In this case user's functions are not called. Type in <b>value()</b> must be the same as in registration 
+/// (parameters registered with functions can be read too, type is a type of function's argument).
+///
+/// During parsing only inputed parameters are checked (existence, repetition, necessity, values existence).
+/// Value is converted and its semantic is checked at first reading, so errors in value are reported 
+/// by <b>value()</b>, and values that are never read cost nothing. Converted value is cached.
+///
+/// Result doesn't depend on <b>argv</b> and on context, copy of result is cheap, and result 
+/// can be passed to another thread. Parser must outlive its results. Result stores only inputed values 
+/// (default values are read from parser), and parsing into the same result again reuses its memory
+/// (if result has no copies), so in steady state it doesn't allocate memory until values are read.
+///
+/// \htmlonly <br/> \endhtmlonly
+///
+/// \subsection variables Parameters bound to variables
+///
+/// Parameter can be bound directly to your variable, without any function:
+///
+/// \code
+///     int threads = 4;
+///     std::string log_dir;
+///     boost::optional< double > ratio;
+///
+///     parser.add_parameter( "-t", "--threads", &threads );
+///     parser.add_parameter( "-l", "--log-dir", &log_dir ).check_semantic( clpp::path );
+///     parser.add_parameter( "-r", &ratio );
+///     parser.parse( argc, argv );
+/// \endcode
+///
+/// Inputed value is converted directly into variable (so memory of string or list variable is reused), 
+/// default value is assigned to variable. Incorrect value (for example, too big number, or list 
+/// with incorrect element) doesn't change variable. If parameter is not inputed and has no default value, 
+/// variable is not changed (so <b>boost::optional</b> variable stays empty). With C++17 compiler 
+/// <b>std::optional</b> variable can be used too. Variable must outlive parser.
+///
 /////////////////////////////////////////////////////////////////////////////////////////
 
 #ifndef CLPP_PARSER_HPP
@@ -620,13 +910,19 @@
 
 #include "detail/checkers/all.hpp"
 #include "detail/user_functions_caller.hpp"
-#include "detail/unnamed_parameters_handler.hpp"
 #include "detail/parameter.hpp"
+#include "detail/parameters_index.hpp"
+#include "detail/tokenizer.hpp"
+#include "detail/parse_context.hpp"
+#include "detail/parse_result.hpp"
+#include "detail/diagnostics.hpp"
+#include "detail/instrumentation.hpp"
 #include "detail/misc.hpp"
 
 #include <boost/noncopyable.hpp>
 #include <boost/assign.hpp>
-#include <boost/ptr_container/ptr_vector.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/type_traits/is_const.hpp>
 
 /// \namespace clpp
 /// \brief Main namespace of library.
@@ -639,13 +935,14 @@ using namespace boost::assign;
 ///
 /// Presents parsing functionality.
 class command_line_parameters_parser : boost::noncopyable {
-    typedef detail::common_checker< parameters, detail::parameter_parts_extractor, std::string > checker;
-    typedef boost::ptr_vector< checker >    common_checkers;
-    typedef common_checkers::iterator       checker_it;
-    typedef common_checkers::const_iterator checker_const_it;
 public:
     command_line_parameters_parser() : 
-    		name_value_separator( "=" ) {} 
+            index( registered_parameters )
+            , frozen( false )
+            , response_files_allowed( false )
+            , unnamed_handler( registered_parameters, registered_orders, tables )
+            , caller( registered_parameters, tables )
+    		, name_value_separator( "=" ) {} 
 public:
     parameter& add_parameter( const std::string& short_name
                         	 , const std::string& full_name
@@ -805,18 +1102,93 @@ public:
                         	 , void ( ObjectType::*fn )( ArgType ) const ) {  
         return create_parameter( single_name, "", obj, fn );
     }
+public:
+    /// Parameter without value and without function: its inputing is taken from parse result.
+    parameter& add_parameter( const std::string& short_name, const std::string& full_name ) {
+        return create_parameter_without_function( short_name, full_name, boost::type< void >() );
+    }
+
+    /// Parameter with value of type 'ArgType', without function: its value is taken from parse result.
+    template< typename ArgType >
+    parameter& add_parameter( const std::string& short_name, const std::string& full_name ) {
+        return create_parameter_without_function( short_name, full_name, boost::type< ArgType >() );
+    }
+
+    parameter& add_parameter( const std::string& single_name ) {
+        return create_parameter_without_function( single_name, "", boost::type< void >() );
+    }
+
+    template< typename ArgType >
+    parameter& add_parameter( const std::string& single_name ) {
+        return create_parameter_without_function( single_name, "", boost::type< ArgType >() );
+    }
+public:
+    /// Parameter bound to user's variable: value is converted directly into 'variable', 
+    /// without any function. Variable must outlive parser.
+    template< typename ArgType >
+    parameter& add_parameter( const std::string&    short_name
+                              , const std::string&  full_name
+                              , ArgType*            variable ) {
+        return create_parameter( short_name, full_name, variable );
+    }
+
+    /// Variable stays empty if parameter is not inputed and has no default value.
+    template< typename ArgType >
+    parameter& add_parameter( const std::string&            short_name
+                              , const std::string&          full_name
+                              , boost::optional< ArgType >* variable ) {
+        return create_parameter( short_name, full_name, variable );
+    }
+
+    /// Const 'ArgType' is excluded, so full name (string literal) is not taken for variable.
+    template< typename ArgType >
+    typename boost::disable_if< boost::is_const< ArgType >, parameter& >::type
+    add_parameter( const std::string& single_name, ArgType* variable ) {
+        return create_parameter( single_name, "", variable );
+    }
+
+    template< typename ArgType >
+    parameter& add_parameter( const std::string& single_name, boost::optional< ArgType >* variable ) {
+        return create_parameter( single_name, "", variable );
+    }
+
+#ifdef CLPP_STD_OPTIONAL
+    template< typename ArgType >
+    parameter& add_parameter( const std::string&            short_name
+                              , const std::string&          full_name
+                              , std::optional< ArgType >*   variable ) {
+        return create_parameter( short_name, full_name, variable );
+    }
+
+    template< typename ArgType >
+    parameter& add_parameter( const std::string& single_name, std::optional< ArgType >* variable ) {
+        return create_parameter( single_name, "", variable );
+    }
+#endif
 private:
-    parameters registered_parameters;
+    /// Declared before parameters: holders must outlive them.
+    detail::arg_holders_storage         holders;
+    parameters                          registered_parameters;
+    detail::orders_storage              registered_orders;
+    detail::parameters_index            index;
+    detail::parameters_tables           tables;
+    bool                                frozen;
+    bool                                response_files_allowed;
+    detail::unnamed_parameters_handler  unnamed_handler;
+    detail::path_checks                 path_checker;
+    detail::user_functions_caller       caller;
+    parse_context                       own_context;
 private:
     template< typename PtrToFun >
     parameter& create_parameter( const std::string&  short_name
                                 , const std::string& full_name
                                 , const PtrToFun&    ptr_to_fun ) { 
+        check_registration_possibility_of( short_name );
         check_null_ptr( ptr_to_fun, short_name );
         check_names_validity( short_name, full_name );
 
-        registered_parameters += parameter( short_name, full_name, ptr_to_fun );
-        return registered_parameters.back();
+        registered_parameters.push_back( parameter( short_name, full_name, ptr_to_fun, holders ) );
+        return register_last_parameter();
     }
 
     template
@@ -828,14 +1200,43 @@ private:
                                 , const std::string& full_name
                                 , const PtrToObj&    ptr_to_obj
                                 , const PtrToObjFun& ptr_to_fun ) {
+        check_registration_possibility_of( short_name );
         check_null_ptr( ptr_to_obj, short_name );
         check_null_ptr( ptr_to_fun, short_name );
         check_names_validity( short_name, full_name );
         
-        registered_parameters += parameter( short_name, full_name, ptr_to_obj, ptr_to_fun );
-        return registered_parameters.back();
+        registered_parameters.push_back( parameter( short_name, full_name, ptr_to_obj, ptr_to_fun, holders ) );
+        return register_last_parameter();
+    }
+
+    template< typename ArgType >
+    parameter& create_parameter_without_function( const std::string&                short_name
+                                                  , const std::string&              full_name
+                                                  , const boost::type< ArgType >&   type ) {
+        check_registration_possibility_of( short_name );
+        check_names_validity( short_name, full_name );
+
+        registered_parameters.push_back( parameter( short_name, full_name, type, holders ) );
+        return register_last_parameter();
+    }
+
+    parameter& register_last_parameter() {
+        parameter& last_parameter = registered_parameters.back();
+        last_parameter.orders = &registered_orders;
+        last_parameter.parser_is_frozen = &frozen;
+        index.add( last_parameter, registered_parameters.size() - 1 );
+        return last_parameter;
     }
 private:
+    void check_registration_possibility_of( const std::string& parameter_name ) const {
+        if ( frozen ) {
+            const std::string what_happened = lib_prefix()
+                                              + "Parser is frozen, so parameter '" + parameter_name 
+                                              + "' cannot be registered!";
+            throw std::logic_error( what_happened );
+        } else {}
+    }
+
     template< typename Ptr >
     void check_null_ptr( const Ptr& ptr, const std::string& parameter_name ) const {
         if ( 0 == ptr ) {
@@ -870,24 +1271,28 @@ private:
     }
     
     void check_uniqueness_of( const std::string& name ) const {
-        parameter_const_it it = std::find( registered_parameters.begin()
-                                           , registered_parameters.end()
-                                           , name );
-        if ( registered_parameters.end() != it ) {
+        if ( index.contains( name ) ) {
             const std::string what_happened = "Parameter with name '" + name + "' already exists!";
             throw std::invalid_argument( what_happened );
         } else {}
     } 
 private:
     std::string name_value_separator;
-    common_checkers checkers;
-    detail::parameter_parts_extractor_p extractor;
 public:
     void set_value_separator( char separator ) {
+        check_separator_changing_possibility();
         check_printable_of( separator );
         name_value_separator = separator;
     }
 private:
+    void check_separator_changing_possibility() const {
+        if ( frozen ) {
+            const std::string what_happened = lib_prefix()
+                                              + "Parser is frozen, so name-value separator cannot be changed!";
+            throw std::logic_error( what_happened );
+        } else {}
+    }
+
     void check_printable_of( char separator ) const {
         const int ascii_code = separator;
         if ( ascii_code <= 0x20 ) {
@@ -898,97 +1303,230 @@ private:
         } else {}
     }
 public:
-    void parse( int argc, char** argv ) {
-        detail::str_storage inputed_parameters = obtain_parameters_from( argc, argv );
-        if ( there_is_nothing_to_parse( inputed_parameters ) ) {
-            return;
+    /// After this inputed parameter '@path' is replaced by parameters from response file 'path'.
+    void allow_response_files() {
+        check_response_files_allowing_possibility();
+        response_files_allowed = true;
+    }
+private:
+    void check_response_files_allowing_possibility() const {
+        if ( frozen ) {
+            const std::string what_happened = lib_prefix()
+                                              + "Parser is frozen, so response files cannot be allowed!";
+            throw std::logic_error( what_happened );
         } else {}
-        
-        create_parameter_parts_extractor();
-        create_parameters_checkers();
-        base_checks( inputed_parameters );
-        handle_unnamed_parameters( inputed_parameters );
-        remaining_checks( inputed_parameters );
-        call_corresponding_user_functions( inputed_parameters );
+    }
+public:
+    /// All values with 'path' semantic of one parsing are checked by 'checker' at once
+    /// (for example, concurrently, see 'clpp/concurrent_path_checks.hpp'). 
+    /// Checker must outlive parser.
+    void set_paths_existence_checker( const paths_existence_checker& checker ) {
+        check_paths_existence_checker_changing_possibility();
+        path_checker.use( checker );
     }
 private:
-    detail::str_storage obtain_parameters_from( int argc, char** argv ) const {
-        detail::str_storage inputed_parameters;
-        for ( int i = 1; i < argc; ++i ) {
-            inputed_parameters += argv[i];
-        }
-        return inputed_parameters;
+    void check_paths_existence_checker_changing_possibility() const {
+        if ( frozen ) {
+            const std::string what_happened = lib_prefix()
+                                              + "Parser is frozen, so paths existence checker cannot be changed!";
+            throw std::logic_error( what_happened );
+        } else {}
     }
-    
-    bool there_is_nothing_to_parse( const detail::str_storage& inputed_parameters ) const {
-        return inputed_parameters.empty() 
-               && no_parameters_with_default_value()
-               && no_necessary_parameters();
+public:
+    /// Freezes parser: all lookup tables are built once, and after that
+    /// parameters cannot be registered (and separator cannot be changed) anymore.
+    /// Frozen parser can be used for many parsings, without repetition of registration-time work
+    /// and (in steady state) without memory allocation by parser itself.
+    /// Default paths are checked here, only once, and existing paths (values with 'path' semantic)
+    /// are memoized by frozen parser.
+    void freeze() {
+        tables.build( registered_parameters );
+        path_checker.memoize();
+        tables.check_default_paths( registered_parameters, path_checker );
+        frozen = true;
+    }
+
+    bool is_frozen() const { return frozen; }
+public:
+    void parse( int argc, char** argv ) {
+        if ( !frozen ) {
+            tables.build( registered_parameters );
+        } else {}
+
+        no_instrumentation nothing;
+        parse_in( own_context, argc, argv, nothing );
     }
 
-    bool no_parameters_with_default_value() const {
-        parameter_const_it it = std::find_if( registered_parameters.begin()
-                                              , registered_parameters.end()
-                                              , boost::mem_fn( &parameter::has_default_value ) );
-        return registered_parameters.end() == it;
+    /// Parsing with caller-owned context. Parser must be frozen, and in this case
+    /// it can be shared between threads: each thread parses with its own context.
+    /// Note that user's functions are called from parsing threads, take care of their thread safety.
+    void parse( int argc, char** argv, parse_context& context ) const {
+        no_instrumentation nothing;
+        parse( argc, argv, context, nothing );
     }
 
-    bool no_necessary_parameters() const {
-        parameter_const_it it = std::find_if( registered_parameters.begin()
-                                              , registered_parameters.end()
-                                              , boost::mem_fn( &parameter::it_is_necessary ) );
-        return registered_parameters.end() == it;
+    /// Instrumented parsing with caller-owned context: hooks of 'instruments' are called 
+    /// around every phase, check and user's function (see 'no_instrumentation' for interface,
+    /// and 'timing_instrumentation' for ready-made policy). Parser must be frozen.
+    template< typename Instrumentation >
+    void parse( int argc, char** argv, parse_context& context, Instrumentation& instruments ) const {
+        check_frozenness_for_parsing_with_context();
+        parse_in( context, argc, argv, instruments );
     }
-    
-    void handle_unnamed_parameters( detail::str_storage& inputed_parameters ) {
-        detail::unnamed_parameters_handler handle( registered_parameters
-                                                   , *extractor
-                                                   , name_value_separator );
-        handle( inputed_parameters );
+
+    /// Parsing without exceptions about incorrect inputed parameters: all problems are collected 
+    /// in 'problems' (previous content is removed). User's functions are called only if no problems found.
+    /// Returns true if no problems found.
+    bool parse( int argc, char** argv, diagnostics& problems ) {
+        if ( !frozen ) {
+            tables.build( registered_parameters );
+        } else {}
+
+        problems.clear();
+        no_instrumentation nothing;
+        parse_in( own_context, argc, argv, nothing, &problems );
+        return problems.empty();
     }
 
-    void create_parameter_parts_extractor() {
-        extractor.reset( new detail::parameter_parts_extractor( name_value_separator ) );
-    } 
+    /// The same, with caller-owned context. Parser must be frozen.
+    bool parse( int argc, char** argv, parse_context& context, diagnostics& problems ) const {
+        no_instrumentation nothing;
+        return parse( argc, argv, context, problems, nothing );
+    }
+
+    /// The same, instrumented.
+    template< typename Instrumentation >
+    bool parse( int                 argc
+                , char**            argv
+                , parse_context&    context
+                , diagnostics&      problems
+                , Instrumentation&  instruments ) const {
+        check_frozenness_for_parsing_with_context();
+        problems.clear();
+        parse_in( context, argc, argv, instruments, &problems );
+        return problems.empty();
+    }
 
-    void create_parameters_checkers() {
-        using namespace detail;
-
-        checkers.push_back( 
-                new parameters_existence_checker( registered_parameters, *extractor, name_value_separator ) );
-        checkers.push_back( 
-                new parameters_redundancy_checker( registered_parameters, *extractor, name_value_separator ) ); 
-        checkers.push_back( 
-                new parameters_repetition_checker( registered_parameters, *extractor, name_value_separator ) );
-        checkers.push_back( 
-                new incorrect_parameters_checker( registered_parameters, *extractor, name_value_separator ) ); 
-        checkers.push_back( 
-                new necessary_parameters_checker( registered_parameters, *extractor, name_value_separator ) );
-        checkers.push_back( 
-                new parameters_values_checker( registered_parameters, *extractor, name_value_separator ) );
-        checkers.push_back( 
-                new values_semantic_checker( registered_parameters, *extractor, name_value_separator ) );
+    /// Parsing into result, without calling of user's functions: values are taken from 'result' 
+    /// (previous content is replaced). Only inputed parameters are checked here, values are converted 
+    /// and their semantic is checked at first reading of value. Parser must be frozen.
+    void parse( int argc, char** argv, parse_context& context, parse_result& result ) const {
+        check_frozenness_for_parsing_with_context();
+        no_instrumentation nothing;
+        parse_in( context, argc, argv, nothing, 0, &result );
+    }
+private:
+    void check_frozenness_for_parsing_with_context() const {
+        if ( !frozen ) {
+            const std::string what_happened = lib_prefix() 
+                                              + "Parser must be frozen before parsing with context!";
+            throw std::logic_error( what_happened );
+        } else {}
+    }
+
+    /// Without diagnostics first problem is reported by exception.
+    /// With result user's functions are not called, inputed values are collected in result.
+    template< typename Instrumentation >
+    void parse_in( parse_context&           context
+                   , int                    argc
+                   , char**                 argv
+                   , Instrumentation&       instruments
+                   , detail::diagnostics*   problems = 0
+                   , parse_result*          result = 0 ) const {
+        instruments.phase_started( obtaining_phase, context );
+        context.prepare_for_parsing();
+        const bool obtained = obtain_parameters_from( argc, argv, context, problems );
+        instruments.phase_finished( obtaining_phase, context, context.inputed_parameters.size() );
+        if ( !obtained || ( 0 == result && there_is_nothing_to_parse( context.inputed_parameters ) ) ) {
+            return;
+        } else {}
+        
+        instruments.phase_started( tokenizing_phase, context );
+        split_into_tokens( context.inputed_parameters, context.inputed_tokens );
+        instruments.phase_finished( tokenizing_phase, context, context.inputed_tokens.size() );
+
+        instruments.phase_started( checking_phase, context );
+        check( context, instruments, problems, 0 != result );
+        instruments.phase_finished( checking_phase, context, context.inputed_tokens.size() );
+        if ( 0 != problems && !problems->empty() ) {
+            return;
+        } else {}
+
+        if ( 0 != result ) {
+            collect_values( context.inputed_tokens, *result );
+            return;
+        } else {}
+
+        instruments.phase_started( calling_phase, context );
+        const size_t called = caller.call( context.inputed_tokens
+                                           , context.validation.inputed_slots
+                                           , instruments );
+        instruments.phase_finished( calling_phase, context, called );
     }
     
-    void base_checks( const detail::str_storage& inputed_parameters ) {
-        const size_t base_checkers_quantity = 3;
-        for ( checker_const_it it = checkers.begin();
-              checkers.begin() + base_checkers_quantity != it;
-              ++it ) {
-            it->check( inputed_parameters );
+    /// Inputed parameters are views into 'argv' (or into mapped response files), without copying.
+    /// Returns false if some response file cannot be expanded (only in parsing with diagnostics).
+    bool obtain_parameters_from( int                    argc
+                                 , char**               argv
+                                 , parse_context&       context
+                                 , detail::diagnostics* problems ) const {
+        detail::str_views& inputed_parameters = context.inputed_parameters;
+        inputed_parameters.clear();
+        inputed_parameters.reserve( argc );
+        for ( int i = 1; i < argc; ++i ) {
+            const detail::str_view inputed_parameter( argv[i] );
+            if ( !response_files_allowed || !detail::this_is_response_file( inputed_parameter ) ) {
+                inputed_parameters.push_back( inputed_parameter );
+            } else if ( !expand( inputed_parameter, context, problems ) ) {
+                return false;
+            } else {}
         }
-        checkers.erase( checkers.begin(), checkers.begin() + base_checkers_quantity );
+        return true;
+    }
+
+    bool expand( const detail::str_view&    response_file
+                 , parse_context&           context
+                 , detail::diagnostics*     problems ) const {
+        std::string what_happened;
+        if ( context.response_files.expand( response_file, context.inputed_parameters, what_happened ) ) {
+            return true;
+        } else {}
+
+        if ( 0 == problems ) {
+            throw std::runtime_error( what_happened );
+        } else {}
+        problems->add( incorrect_response_file, response_file.to_string(), what_happened );
+        return false;
     }
     
-    void remaining_checks( const detail::str_storage& inputed_parameters ) {
-        for ( checker_const_it it = checkers.begin(); checkers.end() != it; ++it ) {
-            it->check( inputed_parameters );
-        }
+    bool there_is_nothing_to_parse( const detail::str_views& inputed_parameters ) const {
+        return inputed_parameters.empty() && tables.nothing_to_do_without_inputed_parameters();
+    }
+    
+    void split_into_tokens( const detail::str_views& inputed_parameters
+                            , detail::tokens&        inputed_tokens ) const {
+        detail::tokenizer split( index, name_value_separator );
+        split( inputed_parameters, inputed_tokens );
+    }
+
+    template< typename Instrumentation >
+    void check( parse_context&          context
+                , Instrumentation&      instruments
+                , detail::diagnostics*  problems
+                , bool                  values_are_read_lazily ) const {
+        detail::validation_engine engine( registered_parameters
+                                          , tables
+                                          , unnamed_handler
+                                          , path_checker
+                                          , context.validation
+                                          , problems
+                                          , values_are_read_lazily );
+        engine.check( context.inputed_tokens, instruments );
     }
 
-    void call_corresponding_user_functions( const detail::str_storage& inputed_parameters ) {
-        detail::user_functions_caller caller( registered_parameters, *extractor, name_value_separator );
-        caller.call( inputed_parameters );
+    /// Values are copied from tokens, so result doesn't depend on context.
+    void collect_values( const detail::tokens& inputed_tokens, parse_result& result ) const {
+        result.data_for_parsing( registered_parameters, index, tables, path_checker ).collect( inputed_tokens );
     }
 };
 
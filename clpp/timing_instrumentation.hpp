@@ -0,0 +1,159 @@
+// C++ Command line parameters parser.
+// http://clp-parser.sourceforge.net/
+//
+// Copyright (C) Denis Shevchenko, 2010.
+// shev.denis @ gmail.com
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// See http://www.opensource.org/licenses/mit-license.php
+
+#ifndef CLPP_TIMING_INSTRUMENTATION_HPP
+#define CLPP_TIMING_INSTRUMENTATION_HPP
+
+#include "parser.hpp"
+
+#include <boost/chrono/chrono.hpp>
+#include <boost/cstdint.hpp>
+
+#include <map>
+#include <string>
+
+/// \namespace clpp
+/// \brief Main namespace of library.
+namespace clpp {
+
+/// \struct timing
+/// \brief Accumulated measurements of one phase, check or user's function.
+struct timing {
+    timing() : 
+            calls( 0 )
+            , items( 0 )
+            , heap_allocations( 0 )
+            , nanoseconds( 0 ) {}
+
+    size_t              calls;
+    size_t              items;
+    size_t              heap_allocations;
+    boost::int_least64_t nanoseconds;
+};
+
+typedef std::map< std::string, timing > functions_timings;
+
+/// Function that returns quantity of all heap allocations made so far 
+/// (for example, counted by your replacement of global 'operator new').
+typedef size_t ( *heap_allocations_counter )();
+
+/// \struct timing_instrumentation
+/// \brief Instrumentation policy that measures wall time and counters.
+///
+/// Measurements are accumulated over all parsings with this object, 
+/// so one object shouldn't be used by different threads simultaneously.
+/// Depends on Boost.Chrono.
+///
+/// Heap allocations are attributed to every phase, check and user's function. 
+/// By default only heap allocations of parse context are counted (library cannot see others). 
+/// If counter of all heap allocations is given, allocations in your functions and 
+/// in conversions of values (they are made during calls of your functions) are counted too.
+struct timing_instrumentation {
+    typedef boost::chrono::steady_clock clock;
+
+    timing_instrumentation() : 
+            count_heap_allocations( 0 )
+            , context( 0 ) {}
+
+    explicit timing_instrumentation( heap_allocations_counter counter ) : 
+            count_heap_allocations( counter )
+            , context( 0 ) {}
+
+    timing              phases[parse_phases_quantity];
+    timing              checks[parse_checks_quantity];
+    functions_timings   functions;                      /*!< By short names of parameters. */
+private:
+    /// \struct moment
+    /// \brief Start (or end) of measurement.
+    struct moment {
+        moment() : heap_allocations( 0 ) {}
+
+        clock::time_point   time;
+        size_t              heap_allocations;
+    };
+
+    heap_allocations_counter    count_heap_allocations;
+    /// Context of current parsing: checks and functions are inside phases.
+    const parse_context*        context;
+    moment                      phase_start;
+    moment                      check_start;
+    moment                      function_start;
+public:
+    void clear() {
+        for ( size_t i = 0; i < parse_phases_quantity; ++i ) {
+            phases[i] = timing();
+        }
+        for ( size_t i = 0; i < parse_checks_quantity; ++i ) {
+            checks[i] = timing();
+        }
+        functions.clear();
+    }
+public:
+    void phase_started( parse_phase /* phase */, const parse_context& _context ) {
+        context = &_context;
+        phase_start = now();
+    }
+
+    void phase_finished( parse_phase phase, const parse_context& /* context */, size_t items ) {
+        accumulate( phases[phase], phase_start, now(), items );
+    }
+
+    void check_started( parse_check /* check */ ) {
+        check_start = now();
+    }
+
+    void check_finished( parse_check check, size_t items ) {
+        accumulate( checks[check], check_start, now(), items );
+    }
+
+    void function_started( const std::string& /* parameter_name */ ) {
+        function_start = now();
+    }
+
+    /// End is taken before search in 'functions', so memory of new element is not attributed to function.
+    void function_finished( const std::string& parameter_name ) {
+        const moment end = now();
+        accumulate( functions[parameter_name], function_start, end, 1 );
+    }
+private:
+    /// Counter of all allocations includes allocations of context.
+    size_t heap_allocations() const {
+        if ( 0 != count_heap_allocations ) {
+            return count_heap_allocations();
+        } else {}
+        return 0 != context ? context->heap_allocations() : 0;
+    }
+
+    moment now() const {
+        moment current;
+        current.heap_allocations = heap_allocations();
+        current.time = clock::now();
+        return current;
+    }
+
+    void accumulate( timing& measured, const moment& begin, const moment& end, size_t items ) {
+        ++measured.calls;
+        measured.items += items;
+        measured.heap_allocations += end.heap_allocations - begin.heap_allocations;
+        measured.nanoseconds += boost::chrono::duration_cast< boost::chrono::nanoseconds >( end.time - begin.time ).count();
+    }
+};
+
+} // namespace clpp
+
+#endif // CLPP_TIMING_INSTRUMENTATION_HPP
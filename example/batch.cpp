@@ -0,0 +1,57 @@
+// Example of batch usage of CLPP library: validation of job file.
+//
+// Every line of job file is a command line (program name and parameters),
+// all lines are checked against one schema in parallel.
+//
+// Usage: ./batch jobs.txt
+
+#include <clpp/batch_parser.hpp>
+
+#include <iostream>
+
+// Functions are called from worker threads, so they do nothing here.
+void verbose() {}
+void threads( int /* quantity */ ) {}
+void input( const std::string& /* path */ ) {}
+void host( const std::string& /* address */ ) {}
+
+int main( int argc, char* argv[] ) {
+	if ( argc != 2 ) {
+		std::cerr << "Usage: " << argv[0] << " jobs.txt" << std::endl;
+		return 1;
+	}
+
+	clpp::command_line_parameters_parser parser;
+	
+	try {
+		parser.add_parameter( "-v", "--verbose", verbose );
+		parser.add_parameter( "-t", "--threads", threads )
+			  .default_value( 1 )
+			  ;
+		parser.add_parameter( "-i", "--input", input )
+			  .necessary()
+			  ;
+		parser.add_parameter( "-h", "--host", host )
+			  .check_semantic( clpp::ip )
+			  ;
+		parser.freeze();
+		
+		clpp::batch_parser batch( parser );
+		clpp::line_results results;
+		batch.parse_file( argv[1], results );
+
+		size_t incorrect_lines = 0;
+		for ( size_t i = 0; i < results.size(); ++i ) {
+			if ( clpp::incorrect_line == results[i].status ) {
+				std::cout << "line " << i + 1 << ": " << results[i].diagnostic << std::endl;
+				++incorrect_lines;
+			}
+		}
+		std::cout << results.size() << " lines, " << incorrect_lines << " incorrect." << std::endl;
+		return 0 == incorrect_lines ? 0 : 2;
+	} catch ( const std::exception& exc ) {
+		std::cerr << exc.what() << std::endl;
+	}
+	
+	return 1;
+}